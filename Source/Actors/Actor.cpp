@@ -1,14 +1,21 @@
 #include "Actor.h"
 #include "../Game.h"
 #include "../Components/Component.h"
+#include "../LevelSnapshot.h"
 #include <algorithm>
 
+int ComponentTypeId::sNextId = 0;
+
 Actor::Actor(Game* game)
     :mGame(game)
     ,mState(ActorState::Active)
+    ,mIsPersistent(false)
     ,mPosition(Vector2::Zero)
+    ,mPreviousPosition(Vector2::Zero)
     ,mScale(1.0f)
     ,mRotation(0.0f)
+    ,mCachedSlots(0)
+    ,mSnapshotIndex(-1)
 {
     mGame->AddActor(this);
 }
@@ -36,6 +43,42 @@ void Actor::Update(float deltaTime)
 
 void Actor::OnUpdate(float deltaTime) {}
 
+bool Actor::SaveState(LevelSnapshot& snapshot) const
+{
+    snapshot.Write(mState);
+    snapshot.Write(mPosition);
+    snapshot.Write(mPreviousPosition);
+    snapshot.Write(mRotation);
+
+    // Os componentes não mudam depois da criação, então a ordem é sempre a mesma
+    for (const Component* comp : mComponents) {
+        comp->SaveState(snapshot);
+    }
+    return true;
+}
+
+void Actor::LoadState(LevelSnapshot& snapshot)
+{
+    snapshot.Read(mState);
+    snapshot.Read(mPosition);
+    snapshot.Read(mPreviousPosition);
+    snapshot.Read(mRotation);
+
+    for (Component* comp : mComponents) {
+        comp->LoadState(snapshot);
+    }
+}
+
+Vector2 Actor::GetRenderPosition() const
+{
+    // Saltos grandes (respawn, ativação de pool) não são interpolados
+    float maxStep = 4.0f * mGame->GetTileSize();
+    if ((mPosition - mPreviousPosition).LengthSq() > maxStep * maxStep) {
+        return mPosition;
+    }
+    return Vector2::Lerp(mPreviousPosition, mPosition, mGame->GetRenderAlpha());
+}
+
 void Actor::ProcessInput(const Uint8* keyState, SDL_GameController& controller)
 {
     if (mState == ActorState::Active) {
@@ -56,11 +99,19 @@ void Actor::AddComponent(Component* c)
     {
         return a->GetUpdateOrder() < b->GetUpdateOrder();
     });
+    ClearComponentCache();
 }
 
 void Actor::RemoveComponent(const class Component* c) {
     auto iter = std::find(mComponents.begin(), mComponents.end(), c);
     mComponents.erase(iter);
+    ClearComponentCache();
+}
+
+void Actor::ClearComponentCache()
+{
+    mCachedSlots = 0;
+    mComponentOverflow.clear();
 }
 
 
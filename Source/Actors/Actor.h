@@ -1,12 +1,28 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
 #include <SDL_stdinc.h>
 #include "../Math.h"
 #include <SDL.h>
 
 enum class ActorState { Active, Paused, Destroy };
 
+// Small integer id per component type, assigned the first time the type is looked up
+class ComponentTypeId
+{
+public:
+    template<typename T>
+    static int Get()
+    {
+        static const int id = sNextId++;
+        return id;
+    }
+
+private:
+    static int sNextId;
+};
+
 class Actor
 {
 public:
@@ -22,6 +38,11 @@ public:
     const Vector2& GetPosition() const { return mPosition; }
     void SetPosition(const Vector2& pos) { mPosition = pos; }
 
+    // Position at the start of the current simulation step, and the position to draw at
+    // (interpolated between the two by Game::GetRenderAlpha)
+    void SavePreviousPosition() { mPreviousPosition = mPosition; }
+    Vector2 GetRenderPosition() const;
+
     Vector2 GetForward() const { return Vector2(Math::Cos(mRotation), Math::Sin(mRotation)); }
 
     // Scale getter/setter
@@ -38,22 +59,46 @@ public:
     ActorState GetState() const { return mState; }
     void SetState(ActorState state) { mState = state; }
 
+    // Persistent actors (e.g. pooled ones) are not deleted by Game::UnloadScene
+    bool GetIsPersistent() const { return mIsPersistent; }
+    void SetIsPersistent(bool isPersistent) { mIsPersistent = isPersistent; }
+
+    // Whether the actor was created from a level object registered in the game's LevelSnapshot
+    bool GetIsInLevelSnapshot() const { return mSnapshotIndex >= 0; }
+
+    // Writes the state that changes while playing into a LevelSnapshot, and reads it back.
+    // Overrides call the base first and read in the same order they write. SaveState returns
+    // false for actors that can't be restored; their level object is created again instead
+    virtual bool SaveState(class LevelSnapshot& snapshot) const;
+    virtual void LoadState(class LevelSnapshot& snapshot);
+
     virtual float GetWidth() { return -1.0f; }
     virtual float GetHeight(){ return -1.0f; }
 
     // Game getter
     class Game* GetGame() const { return mGame; }
 
-    // Returns a component of type T, or null if doesn't exist
+    // Returns a component of type T (or derived from T), or null if doesn't exist.
+    // The result of each type is cached in a slot indexed by ComponentTypeId, so only the
+    // first lookup after the components change searches them
     template<typename T>
     T* GetComponent() const {
-        for (auto c: mComponents) {
-            T *t = dynamic_cast<T*>(c);
-            if (t != nullptr) {
-                return t;
+        int typeId = ComponentTypeId::Get<T>();
+        if (typeId < NUM_COMPONENT_SLOTS) {
+            Uint32 slotBit = 1u << typeId;
+            if (!(mCachedSlots & slotBit)) {
+                mComponentSlots[typeId] = FindComponent<T>();
+                mCachedSlots |= slotBit;
             }
+            return static_cast<T*>(mComponentSlots[typeId]);
         }
-        return nullptr;
+
+        // Tipos raros, além dos slots fixos
+        auto iter = mComponentOverflow.find(typeId);
+        if (iter == mComponentOverflow.end()) {
+            iter = mComponentOverflow.emplace(typeId, FindComponent<T>()).first;
+        }
+        return static_cast<T*>(iter->second);
     }
 
     void RemoveComponent(const class Component* c);
@@ -68,9 +113,11 @@ protected:
 
     // Actor's state
     ActorState mState;
+    bool mIsPersistent;
 
     // Transform
     Vector2 mPosition;
+    Vector2 mPreviousPosition;
     float mScale;
     float mRotation;
 
@@ -79,8 +126,33 @@ protected:
 
 private:
     friend class Component;
+    friend class LevelSnapshot;
+
+    static const int NUM_COMPONENT_SLOTS = 32;
+
+    template<typename T>
+    T* FindComponent() const {
+        for (auto c: mComponents) {
+            T *t = dynamic_cast<T*>(c);
+            if (t != nullptr) {
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+    // Forgets every cached lookup, called whenever a component is added or removed
+    void ClearComponentCache();
 
     // Adds component to Actor (this is automatically called
     // in the component constructor)
     void AddComponent(class Component *c);
+
+    // Cached GetComponent results: a bit of mCachedSlots is set when the slot is valid
+    mutable class Component* mComponentSlots[NUM_COMPONENT_SLOTS];
+    mutable Uint32 mCachedSlots;
+    mutable std::unordered_map<int, class Component*> mComponentOverflow;
+
+    // Index of this actor in the game's LevelSnapshot, or -1 if it isn't part of one
+    int mSnapshotIndex;
 };
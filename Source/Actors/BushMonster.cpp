@@ -1,7 +1,7 @@
 #include "BushMonster.h"
 
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Skill.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
@@ -33,14 +33,14 @@ BushMonster::BushMonster(Game* game, float width, float height, float moveSpeed,
                                                        spritePath, jsonPath, 998);
 
 
-    mDrawAnimatedComponent->AddAnimation("idle", {35, 17, 18, 19, 20, 21, 22, 36});
-    mDrawAnimatedComponent->AddAnimation("attack", {
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", {35, 17, 18, 19, 20, 21, 22, 36});
+    mAttackAnim = mDrawAnimatedComponent->AddAnimation("attack", {
         0, 1, 2, 3, 4, 5, 6, 7,
         8, 9, 10, 11, 12, 13, 14,
         30, 31, 32
     });
-    mDrawAnimatedComponent->AddAnimation("hit", {33, 15, 16, 34});
-    mDrawAnimatedComponent->AddAnimation("run", {23, 24, 25, 26, 27, 28, 29});
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", {33, 15, 16, 34});
+    mRunAnim = mDrawAnimatedComponent->AddAnimation("run", {23, 24, 25, 26, 27, 28, 29});
 
     mDrawAnimatedComponent->SetAnimation("idle");
     mDrawAnimatedComponent->SetAnimFPS(10.0f);
@@ -99,12 +99,13 @@ void BushMonster::OnUpdate(float deltaTime) {
 
 void BushMonster::ResolveGroundCollision() {
     std::array<bool, 4> collisionSide{};
-    std::vector<Ground*> grounds = GetGame()->GetGrounds();
+    std::vector<Ground*> grounds;
+    GetGame()->QueryGrounds(mAABBComponent->GetWorldMin(), mAABBComponent->GetWorldMax(), grounds);
     if (!grounds.empty()) {
         for (Ground* g : grounds) {
             if (!g->GetIsSpike()) { // Colisão com ground
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                 }
                 else {
                     collisionSide = {false, false, false, false};
@@ -136,8 +137,8 @@ void BushMonster::ResolveGroundCollision() {
                 }
             }
             else if (g->GetIsSpike()) { // Colisão com spikes
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                     // Colidiu top
                     if (collisionSide[0]) {
                         ReceiveHit(10, Vector2::NegUnitY);
@@ -224,15 +225,15 @@ void BushMonster::HandleDash(float deltaTime) {
 
 void BushMonster::ManageAnimations() {
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
         mDrawAnimatedComponent->SetAnimFPS(4.0f / mHitDuration);
     }
     else if (mBushMonsterState == State::Dashing) {
-        mDrawAnimatedComponent->SetAnimation("run");
+        mDrawAnimatedComponent->SetAnimation(mRunAnim);
         mDrawAnimatedComponent->SetAnimFPS(10);
     }
     else if (mBushMonsterState == State::Idle) {
-        mDrawAnimatedComponent->SetAnimation("idle");
+        mDrawAnimatedComponent->SetAnimation(mIdleAnim);
         mDrawAnimatedComponent->SetAnimFPS(10);
     }
 }
@@ -245,12 +246,13 @@ void BushMonster::TriggerBossDefeat() {
     auto* skill = new Skill(mGame, Skill::SkillType::Dash);
     skill->SetPosition(GetPosition());
 
-    auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(Vector2::UnitY);
-    blood->SetParticleSpeedScale(1.4);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 15.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = Vector2::UnitY;
+    blood.mSpeedScale = 1.4f;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(1.0);
@@ -295,3 +297,8 @@ void BushMonster::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool BushMonster::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
@@ -16,6 +16,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Bosses are always created again on respawn, with a fresh fight
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void ResolveGroundCollision() override;
     void MovementAfterPlayerSpotted(float deltaTime);
@@ -42,4 +45,10 @@ private:
 
     float mHitDuration;
     float mHitTimer;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mIdleAnim;
+    int mAttackAnim;
+    int mHitAnim;
+    int mRunAnim;
 };
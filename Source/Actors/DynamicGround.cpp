@@ -5,6 +5,7 @@
 #include "DynamicGround.h"
 #include <unordered_map>
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawPolygonComponent.h"
@@ -127,6 +128,9 @@ void DynamicGround::OnUpdate(float deltaTime) {
                 break;
         }
     }
+
+    // Atualiza as células do ground na grade de colisão (pode ter se movido ou mudado de tamanho)
+    mGame->RefreshGround(this);
 }
 
 void DynamicGround::SetSprites() {
@@ -206,3 +210,31 @@ void DynamicGround::ChangeResolution(float oldScale, float newScale) {
     }
     SetSprites();
 }
+
+bool DynamicGround::SaveState(LevelSnapshot& snapshot) const
+{
+    Ground::SaveState(snapshot);
+    snapshot.Write(mWidth);
+    snapshot.Write(mHeight);
+    snapshot.Write(mIsGrowing);
+    snapshot.Write(mIsDecreasing);
+    return true;
+}
+
+void DynamicGround::LoadState(LevelSnapshot& snapshot)
+{
+    Ground::LoadState(snapshot);
+    snapshot.Read(mWidth);
+    snapshot.Read(mHeight);
+    snapshot.Read(mIsGrowing);
+    snapshot.Read(mIsDecreasing);
+
+    if (mDrawPolygonComponent) {
+        std::vector<Vector2> vertices;
+        vertices.emplace_back(Vector2(-mWidth / 2, -mHeight / 2));
+        vertices.emplace_back(Vector2(mWidth / 2, -mHeight / 2));
+        vertices.emplace_back(Vector2(mWidth / 2, mHeight / 2));
+        vertices.emplace_back(Vector2(-mWidth / 2, mHeight / 2));
+        mDrawPolygonComponent->SetVertices(vertices);
+    }
+}
@@ -39,6 +39,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     float mMaxWidth;
     float mMaxHeight;
@@ -5,8 +5,9 @@
 #include "Enemy.h"
 #include "Effect.h"
 #include "Money.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Random.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
@@ -66,12 +67,12 @@ void Enemy::ReceiveHit(float damage, Vector2 knockBackDirection) {
     mFlashTimer = 0;
     mPlayerSpotted = true;
 
-    auto* blood = new ParticleSystem(mGame, 10, 170.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(knockBackDirection);
-    blood->SetParticleSpeedScale(1);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 10.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = knockBackDirection;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 12);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(0.3);
@@ -91,74 +92,23 @@ bool Enemy::Died() {
             mGame->GetAudio()->PlaySound("KillEnemy/KillEnemy1.wav");
         }
 
-        std::vector<Money*> moneys = mGame->GetMoneys();
-
         // Primeiro dropa 1 dinheiro de cada
         if (mMoneyDrop >= 1) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Small) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 1;
-                    break;
-                }
-            }
+            DropMoney(Money::MoneyType::Small, 1);
         }
         if (mMoneyDrop >= 5) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Medium) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 5;
-                    break;
-                }
-            }
+            DropMoney(Money::MoneyType::Medium, 5);
         }
         if (mMoneyDrop >= 10) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Large) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 10;
-                    break;
-                }
-            }
+            DropMoney(Money::MoneyType::Large, 10);
         }
 
-        // Cria grandes
-        while (mMoneyDrop >= 10) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Large) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 10;
-                    break;
-                }
-            }
+        // Cria grandes, depois médios e pequenos (se um pool acabar, os menores cobrem o resto)
+        while (mMoneyDrop >= 10 && DropMoney(Money::MoneyType::Large, 10)) {
         }
-
-        // Cria médios
-        while (mMoneyDrop >= 5) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Medium) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 5;
-                    break;
-                }
-            }
+        while (mMoneyDrop >= 5 && DropMoney(Money::MoneyType::Medium, 5)) {
         }
-
-        // Cria pequenos
-        while (mMoneyDrop >= 1) {
-            for (Money* m: moneys) {
-                if (m->GetState() == ActorState::Paused && m->GetMoneyType() == Money::MoneyType::Small) {
-                    m->SetState(ActorState::Active);
-                    m->SetPosition(GetPosition());
-                    mMoneyDrop -= 1;
-                    break;
-                }
-            }
+        while (mMoneyDrop >= 1 && DropMoney(Money::MoneyType::Small, 1)) {
         }
 
         return true;
@@ -166,6 +116,17 @@ bool Enemy::Died() {
     return false;
 }
 
+bool Enemy::DropMoney(Money::MoneyType type, int value) {
+    Money* m = mGame->GetMoneyPool().Acquire(static_cast<int>(type));
+    if (!m) {
+        return false;
+    }
+    m->SetState(ActorState::Active);
+    m->SetPosition(GetPosition());
+    mMoneyDrop -= value;
+    return true;
+}
+
 void Enemy::ResolveEnemyCollision() const {
     std::vector<Enemy* > enemies = mGame->GetEnemies();
     if (!enemies.empty()) {
@@ -180,18 +141,19 @@ void Enemy::ResolveEnemyCollision() const {
 }
 
 void Enemy::ResolveGroundCollision() {
-    std::vector<Ground*> grounds = GetGame()->GetGrounds();
+    std::vector<Ground*> grounds;
+    GetGame()->QueryGrounds(mAABBComponent->GetWorldMin(), mAABBComponent->GetWorldMax(), grounds);
     if (!grounds.empty()) {
         for (Ground* g : grounds) {
             if (!g->GetIsSpike()) { // Colisão com ground
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                 }
             }
             else if (g->GetIsSpike()) { // Colisão com spikes
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
                     std::array<bool, 4> collisionSide{};
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                     // Colidiu top
                     if (collisionSide[0]) {
                         ReceiveHit(10, Vector2::NegUnitY);
@@ -221,4 +183,27 @@ bool Enemy::IsOnScreen() {
             GetPosition().x > mGame->GetCamera()->GetPosCamera().x  - mGame->GetLogicalWindowWidth() * mOffscreenLimit &&
             GetPosition().y > mGame->GetCamera()->GetPosCamera().y - mGame->GetLogicalWindowHeight() * mOffscreenLimit &&
             GetPosition().y < mGame->GetCamera()->GetPosCamera().y + mGame->GetLogicalWindowHeight() + mGame->GetLogicalWindowHeight() * mOffscreenLimit);
-}
\ No newline at end of file
+}
+
+bool Enemy::SaveState(LevelSnapshot& snapshot) const
+{
+    Actor::SaveState(snapshot);
+    snapshot.Write(mMoveSpeed);
+    snapshot.Write(mHealthPoints);
+    snapshot.Write(mKnockBackTimer);
+    snapshot.Write(mIsFlashing);
+    snapshot.Write(mFlashTimer);
+    snapshot.Write(mPlayerSpotted);
+    return true;
+}
+
+void Enemy::LoadState(LevelSnapshot& snapshot)
+{
+    Actor::LoadState(snapshot);
+    snapshot.Read(mMoveSpeed);
+    snapshot.Read(mHealthPoints);
+    snapshot.Read(mKnockBackTimer);
+    snapshot.Read(mIsFlashing);
+    snapshot.Read(mFlashTimer);
+    snapshot.Read(mPlayerSpotted);
+}
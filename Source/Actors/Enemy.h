@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Actor.h"
+#include "Money.h"
 
 class Enemy : public Actor
 {
@@ -24,8 +25,13 @@ public:
     void SetId(int id) { mId = id; }
     int GetId() const { return mId; }
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 protected:
     bool Died();
+    // Acquires a coin from the money pool; false when the pool is exhausted
+    bool DropMoney(Money::MoneyType type, int value);
     void ResolveEnemyCollision() const;
     virtual void ResolveGroundCollision();
     bool IsOnScreen();
@@ -5,8 +5,9 @@
 #include "EnemySimple.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawSpriteComponent.h"
@@ -30,10 +31,10 @@ EnemySimple::EnemySimple(Game* game, float width, float height, float moveSpeed,
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 1.5f, mHeight * 1.5f, "../Assets/Sprites/Slime/Slime.png", "../Assets/Sprites/Slime/Slime.json", 999);
     std::vector walk = {0, 1, 2, 3, 4, 6};
-    mDrawAnimatedComponent->AddAnimation("walk", walk);
+    mWalkAnim = mDrawAnimatedComponent->AddAnimation("walk", walk);
 
     std::vector hit = {5};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("walk");
     mDrawAnimatedComponent->SetAnimFPS(8.0f);
@@ -76,12 +77,13 @@ void EnemySimple::OnUpdate(float deltaTime) {
 
         mGame->GetCamera()->StartCameraShake(0.3, mCameraShakeStrength);
 
-        auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-        blood->SetPosition(GetPosition());
-        blood->SetEmitDirection(Vector2::UnitY);
-        blood->SetParticleSpeedScale(1.4);
-        blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-        blood->SetParticleGravity(true);
+        ParticleParams blood;
+        blood.mSize = 15.0f;
+        blood.mLifeTime = 3.0f;
+        blood.mDirection = Vector2::UnitY;
+        blood.mSpeedScale = 1.4f;
+        blood.mColor = SDL_Color{226, 90, 70, 255};
+        mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
         auto* circleBlur = new Effect(mGame);
         circleBlur->SetDuration(1.0);
@@ -135,10 +137,10 @@ void EnemySimple::MovementBeforePlayerSpotted() {
 
 void EnemySimple::ManageAnimations() {
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("walk");
+        mDrawAnimatedComponent->SetAnimation(mWalkAnim);
     }
 }
 
@@ -185,3 +187,18 @@ void EnemySimple::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool EnemySimple::SaveState(LevelSnapshot& snapshot) const
+{
+    Enemy::SaveState(snapshot);
+    snapshot.Write(mWalkingAroundTimer);
+    snapshot.Write(mWalkingAroundMoveSpeed);
+    return true;
+}
+
+void EnemySimple::LoadState(LevelSnapshot& snapshot)
+{
+    Enemy::LoadState(snapshot);
+    snapshot.Read(mWalkingAroundTimer);
+    snapshot.Read(mWalkingAroundMoveSpeed);
+}
@@ -15,6 +15,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     void MovementAfterPlayerSpotted();
     void MovementBeforePlayerSpotted();
@@ -27,4 +30,8 @@ private:
     float mWalkingAroundDuration;
     float mWalkingAroundMoveSpeed;
     float mGravity;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mWalkAnim;
+    int mHitAnim;
 };
@@ -3,7 +3,7 @@
 //
 
 #include "FireBall.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
@@ -45,13 +45,13 @@ FireBall::FireBall(class Game* game)
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 1.8f, mHeight * 1.8f, "../Assets/Sprites/Fireball2/Fireball.png", "../Assets/Sprites/Fireball2/Fireball.json", 1001);
 
     std::vector<int> firing = {0, 1, 2, 3};
-    mDrawAnimatedComponent->AddAnimation("firing", firing);
+    mFiringAnim = mDrawAnimatedComponent->AddAnimation("firing", firing);
 
     std::vector<int> explosion = {5, 6, 7, 8, 4, 4};
-    mDrawAnimatedComponent->AddAnimation("explosion", explosion);
+    mExplosionAnim = mDrawAnimatedComponent->AddAnimation("explosion", explosion);
 
     const std::vector end = {4};
-    mDrawAnimatedComponent->AddAnimation("end", end);
+    mEndAnim = mDrawAnimatedComponent->AddAnimation("end", end);
 
     mDrawAnimatedComponent->SetAnimation("firing");
     const float fps = 4.0f / mDeactivateDuration;
@@ -60,12 +60,14 @@ FireBall::FireBall(class Game* game)
 
     mRigidBodyComponent = new RigidBodyComponent(this, 1, 40000, 1800);
     mAABBComponent = new AABBComponent(this, v1, v3);
+    // Rápido o bastante para atravessar grounds finos entre dois frames
+    mAABBComponent->SetCollisionMode(CollisionMode::Swept);
 
-    mGame->AddFireBall(this);
+    // Começa livre no pool
+    Deactivate();
 }
 
 FireBall::~FireBall() {
-    mGame->RemoveFireball(this);
 }
 
 void FireBall::OnUpdate(float deltaTime) {
@@ -86,7 +88,7 @@ void FireBall::OnUpdate(float deltaTime) {
                     }
                 }
                 mDrawAnimatedComponent->ResetAnimationTimer();
-                mDrawAnimatedComponent->SetAnimation("explosion");
+                mDrawAnimatedComponent->SetAnimation(mExplosionAnim);
                 mWidth *= 1.5;
                 mHeight *= 1.5;
                 if (mDrawAnimatedComponent) {
@@ -102,7 +104,7 @@ void FireBall::OnUpdate(float deltaTime) {
             // Verifica se fireball está fora da tela mais um intervalo
             if (!IsOnScreen()) {
                 mDrawAnimatedComponent->ResetAnimationTimer();
-                mDrawAnimatedComponent->SetAnimation("explosion");
+                mDrawAnimatedComponent->SetAnimation(mExplosionAnim);
                 mWidth *= 1.5;
                 mHeight *= 1.5;
                 if (mDrawAnimatedComponent) {
@@ -125,13 +127,14 @@ void FireBall::OnUpdate(float deltaTime) {
 }
 
 void FireBall::ExplosionEffect() {
-    auto* explosion = new ParticleSystem(mGame, mWidth / 5 / mGame->GetScale(), 200.0, 0.2, 0.07f);
-    explosion->SetPosition(GetPosition() + GetForward() * (mWidth / 2));
-    explosion->SetEmitDirection(Vector2::Zero);
-    explosion->SetIsSplash(true);
-    explosion->SetParticleSpeedScale(mWidth / 50 / mGame->GetScale());
-    explosion->SetParticleColor(SDL_Color{247, 118, 34, 255});
-    explosion->SetParticleGravity(false);
+    ParticleParams explosion;
+    explosion.mSize = mWidth / 5 / mGame->GetScale();
+    explosion.mLifeTime = 0.2f;
+    explosion.mIsSplash = true;
+    explosion.mSpeedScale = mWidth / 50 / mGame->GetScale();
+    explosion.mColor = SDL_Color{247, 118, 34, 255};
+    explosion.mGravity = false;
+    mGame->GetParticles()->Emit(explosion, GetPosition() + GetForward() * (mWidth / 2), 14);
 }
 
 bool FireBall::IsOnScreen() {
@@ -171,7 +174,7 @@ void FireBall::Activate() {
         mDrawAnimatedComponent->SetWidth(mWidth * 1.8f);
         mDrawAnimatedComponent->SetHeight(mHeight * 1.8f);
         mDrawAnimatedComponent->SetIsVisible(true);
-        mDrawAnimatedComponent->SetAnimation("firing");
+        mDrawAnimatedComponent->SetAnimation(mFiringAnim);
     }
     mRigidBodyComponent->SetVelocity(GetForward() * mSpeed);
     if (!mSound.IsValid()) {
@@ -197,36 +200,32 @@ void FireBall::Deactivate() {
     }
     if (mDrawAnimatedComponent) {
         mDrawAnimatedComponent->SetIsVisible(false);
-        mDrawAnimatedComponent->SetAnimation("end");
+        mDrawAnimatedComponent->SetAnimation(mEndAnim);
     }
     SetState(ActorState::Paused);
     mSound.Reset();
+    mGame->GetFireBallPool().Release(this);
 }
 
 void FireBall::ResolveGroundCollision() {
-    std::vector<Ground*> grounds = mGame->GetGrounds();
-    if (!grounds.empty()) {
-        for (Ground* g : grounds) {
-            if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                if (mSound.IsValid()) {
-                    if (mGame->GetAudio()->GetSoundState(mSound) == SoundState::Playing) {
-                        mGame->GetAudio()->StopSound(mSound);
-                    }
-                    // Verifica se fireball está dentro da tela mais um intervalo
-                    if (IsOnScreen()) {
-                        mGame->GetAudio()->PlaySound("FireBall/ExplodeFireBall.wav");
-                    }
-                }
-                mDrawAnimatedComponent->ResetAnimationTimer();
-                mDrawAnimatedComponent->SetAnimation("explosion");
-                mFireballState = State::Exploding;
-                mWidth *= 1.5;
-                mHeight *= 1.5;
-                if (mDrawAnimatedComponent) {
-                    mDrawAnimatedComponent->SetWidth(mWidth * 1.8f);
-                    mDrawAnimatedComponent->SetHeight(mHeight * 1.8f);
-                }
+    if (mGame->CollidesWithGround(mAABBComponent)) {
+        if (mSound.IsValid()) {
+            if (mGame->GetAudio()->GetSoundState(mSound) == SoundState::Playing) {
+                mGame->GetAudio()->StopSound(mSound);
             }
+            // Verifica se fireball está dentro da tela mais um intervalo
+            if (IsOnScreen()) {
+                mGame->GetAudio()->PlaySound("FireBall/ExplodeFireBall.wav");
+            }
+        }
+        mDrawAnimatedComponent->ResetAnimationTimer();
+        mDrawAnimatedComponent->SetAnimation(mExplosionAnim);
+        mFireballState = State::Exploding;
+        mWidth *= 1.5;
+        mHeight *= 1.5;
+        if (mDrawAnimatedComponent) {
+            mDrawAnimatedComponent->SetWidth(mWidth * 1.8f);
+            mDrawAnimatedComponent->SetHeight(mHeight * 1.8f);
         }
     }
 }
@@ -248,7 +247,7 @@ void FireBall::ResolveEnemyCollision() {
                         }
                     }
                     mDrawAnimatedComponent->ResetAnimationTimer();
-                    mDrawAnimatedComponent->SetAnimation("explosion");
+                    mDrawAnimatedComponent->SetAnimation(mExplosionAnim);
                     mFireballState = State::Exploding;
                     mWidth *= 1.5;
                     mHeight *= 1.5;
@@ -277,7 +276,7 @@ void FireBall::ResolvePlayerCollision() {
                 }
             }
             mDrawAnimatedComponent->ResetAnimationTimer();
-            mDrawAnimatedComponent->SetAnimation("explosion");
+            mDrawAnimatedComponent->SetAnimation(mExplosionAnim);
             mFireballState = State::Exploding;
             mWidth *= 1.5;
             mHeight *= 1.5;
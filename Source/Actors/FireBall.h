@@ -6,8 +6,9 @@
 
 #include "Actor.h"
 #include "../AudioSystem.h"
+#include "../ObjectPool.h"
 
-class FireBall : public Actor
+class FireBall : public Actor, public Pooled<FireBall>
 {
 public:
     enum class State
@@ -67,6 +68,10 @@ private:
     class DrawPolygonComponent *mDrawPolygonComponent;
     class DrawSpriteComponent *mDrawSpriteComponent;
     class DrawAnimatedComponent *mDrawAnimatedComponent;
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mFiringAnim;
+    int mExplosionAnim;
+    int mEndAnim;
 
     class RigidBodyComponent *mRigidBodyComponent;
     class AABBComponent *mAABBComponent;
@@ -5,8 +5,9 @@
 #include "FlyingEnemySimple.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawSpriteComponent.h"
@@ -31,10 +32,10 @@ FlyingEnemySimple::FlyingEnemySimple(Game *game, float width, float height, floa
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 2.0f, mHeight * 2.0f, "../Assets/Sprites/Beetle/Beetle.png", "../Assets/Sprites/Beetle/Beetle.json", 999);
     std::vector fly = {0, 1, 2, 3};
-    mDrawAnimatedComponent->AddAnimation("fly", fly);
+    mFlyAnim = mDrawAnimatedComponent->AddAnimation("fly", fly);
 
     std::vector hit = {4};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("fly");
     mDrawAnimatedComponent->SetAnimFPS(8.0f);
@@ -73,12 +74,13 @@ void FlyingEnemySimple::OnUpdate(float deltaTime) {
 
         mGame->GetCamera()->StartCameraShake(0.3, mCameraShakeStrength);
 
-        auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-        blood->SetPosition(GetPosition());
-        blood->SetEmitDirection(Vector2::UnitY);
-        blood->SetParticleSpeedScale(1.4);
-        blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-        blood->SetParticleGravity(true);
+        ParticleParams blood;
+        blood.mSize = 15.0f;
+        blood.mLifeTime = 3.0f;
+        blood.mDirection = Vector2::UnitY;
+        blood.mSpeedScale = 1.4f;
+        blood.mColor = SDL_Color{226, 90, 70, 255};
+        mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
         auto* circleBlur = new Effect(mGame);
         circleBlur->SetDuration(1.0);
@@ -137,10 +139,10 @@ void FlyingEnemySimple::ManageAnimations() {
     }
 
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("fly");
+        mDrawAnimatedComponent->SetAnimation(mFlyAnim);
     }
 }
 
@@ -184,3 +186,18 @@ void FlyingEnemySimple::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool FlyingEnemySimple::SaveState(LevelSnapshot& snapshot) const
+{
+    Enemy::SaveState(snapshot);
+    snapshot.Write(mFlyingAroundTimer);
+    snapshot.Write(mFlyingAroundMoveSpeed);
+    return true;
+}
+
+void FlyingEnemySimple::LoadState(LevelSnapshot& snapshot)
+{
+    Enemy::LoadState(snapshot);
+    snapshot.Read(mFlyingAroundTimer);
+    snapshot.Read(mFlyingAroundMoveSpeed);
+}
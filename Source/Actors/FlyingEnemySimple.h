@@ -14,6 +14,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     void MovementAfterPlayerSpotted(float deltaTime);
     void MovementBeforePlayerSpotted();
@@ -24,4 +27,8 @@ private:
     float mFlyingAroundTimer;
     float mFlyingAroundDuration;
     float mFlyingAroundMoveSpeed;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mFlyAnim;
+    int mHitAnim;
 };
@@ -5,9 +5,10 @@
 #include "FlyingShooterEnemy.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Projectile.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Random.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
@@ -45,10 +46,10 @@ FlyingShooterEnemy::FlyingShooterEnemy(Game* game, float width, float height, fl
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 2.0f, mHeight * 2.0f, "../Assets/Sprites/Beetle/Beetle.png", "../Assets/Sprites/Beetle/Beetle.json", 999);
     std::vector fly = {0, 1, 2, 3};
-    mDrawAnimatedComponent->AddAnimation("fly", fly);
+    mFlyAnim = mDrawAnimatedComponent->AddAnimation("fly", fly);
 
     std::vector hit = {4};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("fly");
     mDrawAnimatedComponent->SetAnimFPS(8.0f);
@@ -87,12 +88,13 @@ void FlyingShooterEnemy::OnUpdate(float deltaTime) {
 
         mGame->GetCamera()->StartCameraShake(0.3, mCameraShakeStrength);
 
-        auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-        blood->SetPosition(GetPosition());
-        blood->SetEmitDirection(Vector2::UnitY);
-        blood->SetParticleSpeedScale(1.4);
-        blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-        blood->SetParticleGravity(true);
+        ParticleParams blood;
+        blood.mSize = 15.0f;
+        blood.mLifeTime = 3.0f;
+        blood.mDirection = Vector2::UnitY;
+        blood.mSpeedScale = 1.4f;
+        blood.mColor = SDL_Color{226, 90, 70, 255};
+        mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
         auto* circleBlur = new Effect(mGame);
         circleBlur->SetDuration(1.0);
@@ -200,22 +202,19 @@ void FlyingShooterEnemy::Shoot(float deltaTime) {
         if (direction.Length() > 0) {
             direction.Normalize();
         }
-        std::vector<Projectile* > projectiles = mGame->GetProjectiles();
-        for (Projectile* p: projectiles) {
-            if (p->GetState() == ActorState::Paused && p->GetProjectileType() == Projectile::ProjectileType::Acid) {
-                p->SetState(ActorState::Active);
-                p->SetRotation(Math::Atan2(direction.y, direction.x));
-                p->SetWidth(mProjectileWidth);
-                p->SetHeight(mProjectileHeight);
-                p->SetSpeed(mProjectileSpeed);
-                p->SetDamage(10);
-                if (GetRotation() == 0) {
-                    p->SetPosition(GetPosition() + Vector2(mWidth / 2,0));
-                }
-                else if (GetRotation() == Math::Pi) {
-                    p->SetPosition(GetPosition() - Vector2(mWidth / 2,0));
-                }
-                break;
+        Projectile* p = mGame->GetProjectilePool().Acquire(static_cast<int>(Projectile::ProjectileType::Acid));
+        if (p) {
+            p->SetState(ActorState::Active);
+            p->SetRotation(Math::Atan2(direction.y, direction.x));
+            p->SetWidth(mProjectileWidth);
+            p->SetHeight(mProjectileHeight);
+            p->SetSpeed(mProjectileSpeed);
+            p->SetDamage(10);
+            if (GetRotation() == 0) {
+                p->SetPosition(GetPosition() + Vector2(mWidth / 2,0));
+            }
+            else if (GetRotation() == Math::Pi) {
+                p->SetPosition(GetPosition() - Vector2(mWidth / 2,0));
             }
         }
         mShot = true;
@@ -242,10 +241,10 @@ void FlyingShooterEnemy::ManageAnimations() {
     }
 
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("fly");
+        mDrawAnimatedComponent->SetAnimation(mFlyAnim);
     }
 }
 
@@ -295,3 +294,32 @@ void FlyingShooterEnemy::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool FlyingShooterEnemy::SaveState(LevelSnapshot& snapshot) const
+{
+    Enemy::SaveState(snapshot);
+    snapshot.Write(mFlyingAroundTimer);
+    snapshot.Write(mFlyingAroundMoveSpeed);
+    snapshot.Write(mState);
+    snapshot.Write(mCurrentTarget);
+    snapshot.Write(mTargetSet);
+    snapshot.Write(mPatrolTargetTimer);
+    snapshot.Write(mFlyTimer);
+    snapshot.Write(mShootTimer);
+    snapshot.Write(mShot);
+    return true;
+}
+
+void FlyingShooterEnemy::LoadState(LevelSnapshot& snapshot)
+{
+    Enemy::LoadState(snapshot);
+    snapshot.Read(mFlyingAroundTimer);
+    snapshot.Read(mFlyingAroundMoveSpeed);
+    snapshot.Read(mState);
+    snapshot.Read(mCurrentTarget);
+    snapshot.Read(mTargetSet);
+    snapshot.Read(mPatrolTargetTimer);
+    snapshot.Read(mFlyTimer);
+    snapshot.Read(mShootTimer);
+    snapshot.Read(mShot);
+}
@@ -21,6 +21,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     void MovementAfterPlayerSpotted(float deltaTime);
     void MovementBeforePlayerSpotted();
@@ -53,4 +56,8 @@ private:
     float mProjectileWidth;
     float mProjectileHeight;
     float mProjectileSpeed;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mFlyAnim;
+    int mHitAnim;
 };
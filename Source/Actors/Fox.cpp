@@ -5,7 +5,7 @@
 #include "Fox.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Skill.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
@@ -73,16 +73,16 @@ Fox::Fox(Game* game, float width, float height, float moveSpeed, float healthPoi
                                                        foxAssets + "Raposa.json", 1000);
 
     std::vector idle = {2};
-    mDrawAnimatedComponent->AddAnimation("idle", idle);
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", idle);
 
     std::vector run = {3, 4, 5, 6, 7};
-    mDrawAnimatedComponent->AddAnimation("run", run);
+    mRunAnim = mDrawAnimatedComponent->AddAnimation("run", run);
 
     std::vector hit = {1};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     std::vector dash = {0};
-    mDrawAnimatedComponent->AddAnimation("dash", dash);
+    mDashAnim = mDrawAnimatedComponent->AddAnimation("dash", dash);
 
 
     mDrawAnimatedComponent->SetAnimation("idle");
@@ -162,12 +162,13 @@ void Fox::TriggerBossDefeat() {
 
     mGame->GetCamera()->StartCameraShake(0.5, mCameraShakeStrength);
 
-    auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(Vector2::UnitY);
-    blood->SetParticleSpeedScale(1.4);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 15.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = Vector2::UnitY;
+    blood.mSpeedScale = 1.4f;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(1.0);
@@ -183,12 +184,13 @@ void Fox::TriggerBossDefeat() {
 
 void Fox::ResolveGroundCollision() {
     std::array<bool, 4> collisionSide{};
-    std::vector<Ground* > grounds = GetGame()->GetGrounds();
+    std::vector<Ground*> grounds;
+    GetGame()->QueryGrounds(mAABBComponent->GetWorldMin(), mAABBComponent->GetWorldMax(), grounds);
     if (!grounds.empty()) {
         for (Ground* g: grounds) {
             if (!g->GetIsSpike()) { // Colisão com ground
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                 }
                 else {
                     collisionSide = {false, false, false, false};
@@ -205,8 +207,8 @@ void Fox::ResolveGroundCollision() {
                 }
             }
             else if (g->GetIsSpike()) { // Colisão com spikes
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                     // Colidiu top
                     if (collisionSide[0]) {
                         ReceiveHit(10, Vector2::NegUnitY);
@@ -299,16 +301,16 @@ void Fox::MovementBeforePlayerSpotted() {
 
 void Fox::ManageAnimations() {
     if (mIsRunning) {
-        mDrawAnimatedComponent->SetAnimation("run");
+        mDrawAnimatedComponent->SetAnimation(mRunAnim);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("idle");
+        mDrawAnimatedComponent->SetAnimation(mIdleAnim);
     }
     if (mDashComponent->GetIsDashing()) {
-        mDrawAnimatedComponent->SetAnimation("dash");
+        mDrawAnimatedComponent->SetAnimation(mDashAnim);
     }
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
     }
 }
 
@@ -421,18 +423,15 @@ void Fox::Fireball(float deltaTime)
             SetRotation(Math::Pi);
         }
 
-        std::vector<FireBall* > fireBalls = GetGame()->GetFireBalls();
-        for (FireBall* f: fireBalls) {
-            if (f->GetState() == ActorState::Paused) {
-                f->SetState(ActorState::Active);
-                f->SetRotation(GetRotation());
-                f->SetWidth(mFireballWidth);
-                f->SetHeight(mFireBallHeight);
-                f->SetSpeed(mFireballSpeed);
-                f->SetIsFromEnemy();
-                f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
-                break;
-            }
+        FireBall* f = GetGame()->GetFireBallPool().Acquire();
+        if (f) {
+            f->SetState(ActorState::Active);
+            f->SetRotation(GetRotation());
+            f->SetWidth(mFireballWidth);
+            f->SetHeight(mFireBallHeight);
+            f->SetSpeed(mFireballSpeed);
+            f->SetIsFromEnemy();
+            f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
         }
 
         mAlreadyFireballed = true;
@@ -517,3 +516,8 @@ void Fox::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool Fox::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
@@ -25,6 +25,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Bosses are always created again on respawn, with a fresh fight
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void ResolveGroundCollision() override;
     void ResolvePlayerCollision();
@@ -83,4 +86,10 @@ private:
     State mState;
 
     class DashComponent* mDashComponent;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mIdleAnim;
+    int mRunAnim;
+    int mHitAnim;
+    int mDashAnim;
 };
@@ -6,7 +6,7 @@
 #include "Actor.h"
 #include "Effect.h"
 #include "FrogTongue.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Skill.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
@@ -63,28 +63,28 @@ Frog::Frog(Game* game, float width, float height, float moveSpeed, float healthP
                                                        frogAssets + "Frog.json", 999);
 
     std::vector hitIdle = {0};
-    mDrawAnimatedComponent->AddAnimation("hitIdle", hitIdle);
+    mHitIdleAnim = mDrawAnimatedComponent->AddAnimation("hitIdle", hitIdle);
 
     std::vector hitJump = {1};
-    mDrawAnimatedComponent->AddAnimation("hitJump", hitJump);
+    mHitJumpAnim = mDrawAnimatedComponent->AddAnimation("hitJump", hitJump);
 
     std::vector hitSide = {2};
-    mDrawAnimatedComponent->AddAnimation("hitSide", hitSide);
+    mHitSideAnim = mDrawAnimatedComponent->AddAnimation("hitSide", hitSide);
 
     std::vector hitTongue = {3};
-    mDrawAnimatedComponent->AddAnimation("hitTongue", hitTongue);
+    mHitTongueAnim = mDrawAnimatedComponent->AddAnimation("hitTongue", hitTongue);
 
     std::vector idle = {4};
-    mDrawAnimatedComponent->AddAnimation("idle", idle);
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", idle);
 
     std::vector jump = {5};
-    mDrawAnimatedComponent->AddAnimation("jump", jump);
+    mJumpAnim = mDrawAnimatedComponent->AddAnimation("jump", jump);
 
     std::vector side = {6};
-    mDrawAnimatedComponent->AddAnimation("side", side);
+    mSideAnim = mDrawAnimatedComponent->AddAnimation("side", side);
 
     std::vector tongue = {7};
-    mDrawAnimatedComponent->AddAnimation("tongue", tongue);
+    mTongueAnim = mDrawAnimatedComponent->AddAnimation("tongue", tongue);
 
     mDrawAnimatedComponent->SetAnimation("idle");
     mDrawAnimatedComponent->SetAnimFPS(16.0f);
@@ -221,12 +221,13 @@ void Frog::TriggerBossDefeat() {
 
     mGame->GetCamera()->StartCameraShake(0.5, mCameraShakeStrength);
 
-    auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(Vector2::UnitY);
-    blood->SetParticleSpeedScale(1.4);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 15.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = Vector2::UnitY;
+    blood.mSpeedScale = 1.4f;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(1.0);
@@ -241,12 +242,13 @@ void Frog::TriggerBossDefeat() {
 
 void Frog::ResolveGroundCollision() {
     std::array<bool, 4> collisionSide{};
-    std::vector<Ground* > grounds = GetGame()->GetGrounds();
+    std::vector<Ground*> grounds;
+    GetGame()->QueryGrounds(mAABBComponent->GetWorldMin(), mAABBComponent->GetWorldMax(), grounds);
     if (!grounds.empty()) {
         for (Ground* g: grounds) {
             if (!g->GetIsSpike()) { // Colisão com ground
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                     mIsOnGround = true;
                     if (collisionSide[0]) {
                         mWallPosition = WallSide::Bottom;
@@ -263,8 +265,8 @@ void Frog::ResolveGroundCollision() {
                 }
             }
             else if (g->GetIsSpike()) { // Colisão com spikes
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                     // Colidiu top
                     if (collisionSide[0]) {
                         ReceiveHit(10, Vector2::NegUnitY);
@@ -323,13 +325,13 @@ void Frog::MovementBeforePlayerSpotted() {
 
 void Frog::ManageAnimations() {
     if (mState == State::Tongue) {
-        mDrawAnimatedComponent->SetAnimation("tongue");
+        mDrawAnimatedComponent->SetAnimation(mTongueAnim);
     }
     else if (mIsOnGround) {
-        mDrawAnimatedComponent->SetAnimation("idle");
+        mDrawAnimatedComponent->SetAnimation(mIdleAnim);
         if (mWallPosition == WallSide::Bottom) {
             if (mDrawAnimatedComponent) {
-                mDrawAnimatedComponent->SetAnimation("side");
+                mDrawAnimatedComponent->SetAnimation(mSideAnim);
                 mDrawAnimatedComponent->UseRotation(false);
                 mDrawAnimatedComponent->SetOffsetRotation(0.0f);
                 mDrawAnimatedComponent->UseFlip(false);
@@ -363,7 +365,7 @@ void Frog::ManageAnimations() {
     }
     else {
         if (mDrawAnimatedComponent) {
-            mDrawAnimatedComponent->SetAnimation("jump");
+            mDrawAnimatedComponent->SetAnimation(mJumpAnim);
             mDrawAnimatedComponent->UseRotation(true);
             mDrawAnimatedComponent->UseFlip(false);
             Vector2 vel = mRigidBodyComponent->GetVelocity();
@@ -388,17 +390,17 @@ void Frog::ManageAnimations() {
     if (mIsFlashing) {
         if (mIsOnGround) {
             if (mWallPosition == WallSide::Bottom) {
-                mDrawAnimatedComponent->SetAnimation("hitSide");
+                mDrawAnimatedComponent->SetAnimation(mHitSideAnim);
             }
             else {
-                mDrawAnimatedComponent->SetAnimation("hitIdle");
+                mDrawAnimatedComponent->SetAnimation(mHitIdleAnim);
             }
         }
         else {
-            mDrawAnimatedComponent->SetAnimation("hitJump");
+            mDrawAnimatedComponent->SetAnimation(mHitJumpAnim);
         }
         if (mState == State::Tongue) {
-            mDrawAnimatedComponent->SetAnimation("hitTongue");
+            mDrawAnimatedComponent->SetAnimation(mHitTongueAnim);
         }
     }
 }
@@ -638,3 +640,8 @@ void Frog::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool Frog::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
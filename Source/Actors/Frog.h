@@ -33,6 +33,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Bosses are always created again on respawn, with a fresh fight
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void ResolveGroundCollision() override;
     void ResolvePlayerCollision();
@@ -81,4 +84,14 @@ private:
     std::vector<int> mUnlockGroundsIds;
 
     State mState;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mHitIdleAnim;
+    int mHitJumpAnim;
+    int mHitSideAnim;
+    int mHitTongueAnim;
+    int mIdleAnim;
+    int mJumpAnim;
+    int mSideAnim;
+    int mTongueAnim;
 };
@@ -51,37 +51,37 @@ FrogTongue::FrogTongue(class Game* game, Frog* owner, float damage)
 
 
     const std::vector extending0 = {0};
-    mDrawAnimatedComponent->AddAnimation("extending0", extending0);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending0", extending0));
 
     const std::vector extending1 = {1};
-    mDrawAnimatedComponent->AddAnimation("extending1", extending1);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending1", extending1));
 
     const std::vector extending2 = {2};
-    mDrawAnimatedComponent->AddAnimation("extending2", extending2);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending2", extending2));
 
     const std::vector extending3 = {3};
-    mDrawAnimatedComponent->AddAnimation("extending3", extending3);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending3", extending3));
 
     const std::vector extending4 = {4};
-    mDrawAnimatedComponent->AddAnimation("extending4", extending4);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending4", extending4));
 
     const std::vector extending5 = {5};
-    mDrawAnimatedComponent->AddAnimation("extending5", extending5);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending5", extending5));
 
     const std::vector extending6 = {6};
-    mDrawAnimatedComponent->AddAnimation("extending6", extending6);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending6", extending6));
 
     const std::vector extending7 = {7};
-    mDrawAnimatedComponent->AddAnimation("extending7", extending7);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending7", extending7));
 
     const std::vector extending8 = {8};
-    mDrawAnimatedComponent->AddAnimation("extending8", extending8);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending8", extending8));
 
     const std::vector extending9 = {9};
-    mDrawAnimatedComponent->AddAnimation("extending9", extending9);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending9", extending9));
 
     const std::vector extending10 = {10};
-    mDrawAnimatedComponent->AddAnimation("extending10", extending10);
+    mExtendingAnims.emplace_back(mDrawAnimatedComponent->AddAnimation("extending10", extending10));
 
 
     mDrawAnimatedComponent->SetAnimation("extending0");
@@ -137,7 +137,7 @@ void FrogTongue::OnUpdate(float deltaTime) {
             mDrawAnimatedComponent->SetWidth(mWidth);
             mDrawAnimatedComponent->SetHeight(mHeight);
             mDrawAnimatedComponent->UseRotation(false);
-            mDrawAnimatedComponent->SetAnimation("extending" + std::to_string(mFrameIndex));
+            mDrawAnimatedComponent->SetAnimation(mExtendingAnims[mFrameIndex]);
         }
         if (GetRotation() == 0) {
             SetPosition(mOwner->GetPosition() + Vector2(mWidth / 2, 0) + Vector2(30 * mGame->GetScale(), 0));
@@ -164,10 +164,11 @@ void FrogTongue::OnUpdate(float deltaTime) {
 }
 
 void FrogTongue::ResolveGroundCollision() {
-    std::vector<Ground* > grounds = GetGame()->GetGrounds();
+    std::vector<Ground*> grounds;
+    GetGame()->QueryGrounds(mAABBComponent->GetWorldMin(), mAABBComponent->GetWorldMax(), grounds);
     if (!grounds.empty()) {
         for (Ground* g: grounds) {
-            if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
+            if (mAABBComponent->Intersect(*g->GetAABBComponent())) {
                 mIsIncreasing = false;
                 break;
             }
@@ -250,3 +251,8 @@ void FrogTongue::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool FrogTongue::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
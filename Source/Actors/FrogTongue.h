@@ -17,6 +17,9 @@ public:
     void SetDuration(float duration);
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Created again together with its frog
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void ResolveGroundCollision();
     void ResolvePlayerCollision();
@@ -41,6 +44,8 @@ private:
     class DrawPolygonComponent *mDrawPolygonComponent;
     class DrawSpriteComponent *mDrawSpriteComponent;
     class DrawAnimatedComponent *mDrawAnimatedComponent;
+    // Animation clips, resolved once so per-frame code does no string lookups
+    std::vector<int> mExtendingAnims;
 
     class RigidBodyComponent *mRigidBodyComponent;
     class AABBComponent *mAABBComponent;
@@ -5,7 +5,7 @@
 #include "Golem.h"
 #include "Effect.h"
 #include "Lever.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Skill.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
@@ -65,25 +65,25 @@ Golem::Golem(Game *game, float width, float height, float moveSpeed, float healt
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 1.8f * 1.875f, mWidth * 1.8f, "../Assets/Sprites/Golem2/Golem.png", "../Assets/Sprites/Golem2/Golem.json", 999);
     std::vector idle = {54, 22, 23, 24, 55, 25, 58, 26};
-    mDrawAnimatedComponent->AddAnimation("idle", idle);
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", idle);
 
     std::vector idleInvulnerable = {56, 27, 28, 29, 57, 30, 59, 31};
-    mDrawAnimatedComponent->AddAnimation("idleInvulnerable", idleInvulnerable);
+    mIdleInvulnerableAnim = mDrawAnimatedComponent->AddAnimation("idleInvulnerable", idleInvulnerable);
 
     std::vector walk = {32, 33, 34, 35, 36, 37, 38, 39, 40, 41};
-    mDrawAnimatedComponent->AddAnimation("walk", walk);
+    mWalkAnim = mDrawAnimatedComponent->AddAnimation("walk", walk);
 
     std::vector walkInvulnerable = {42, 43, 44, 45, 46, 47, 48, 49, 50, 51};
-    mDrawAnimatedComponent->AddAnimation("walkInvulnerable", walkInvulnerable);
+    mWalkInvulnerableAnim = mDrawAnimatedComponent->AddAnimation("walkInvulnerable", walkInvulnerable);
 
     std::vector punch = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-    mDrawAnimatedComponent->AddAnimation("punch", punch);
+    mPunchAnim = mDrawAnimatedComponent->AddAnimation("punch", punch);
 
     std::vector punchInvulnerable = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
-    mDrawAnimatedComponent->AddAnimation("punchInvulnerable", punchInvulnerable);
+    mPunchInvulnerableAnim = mDrawAnimatedComponent->AddAnimation("punchInvulnerable", punchInvulnerable);
 
     std::vector hit = {52, 20, 21, 53};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("idle");
     mDrawAnimatedComponent->SetAnimFPS(10.0f);
@@ -315,19 +315,16 @@ void Golem::Fireball(float deltaTime) {
     }
 
     if (!mAlreadyFireBalled) {
-        std::vector<FireBall* > fireBalls = GetGame()->GetFireBalls();
-        for (FireBall* f: fireBalls) {
-            if (f->GetState() == ActorState::Paused) {
-                f->SetState(ActorState::Active);
-                f->SetRotation(GetRotation());
-                f->SetWidth(mFireballWidth);
-                f->SetHeight(mFireBallHeight);
-                f->SetSpeed(mFireballSpeed);
-                f->SetDamage(mFireballDamage);
-                f->SetIsFromEnemy();
-                f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
-                break;
-            }
+        FireBall* f = GetGame()->GetFireBallPool().Acquire();
+        if (f) {
+            f->SetState(ActorState::Active);
+            f->SetRotation(GetRotation());
+            f->SetWidth(mFireballWidth);
+            f->SetHeight(mFireBallHeight);
+            f->SetSpeed(mFireballSpeed);
+            f->SetDamage(mFireballDamage);
+            f->SetIsFromEnemy();
+            f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
         }
         mAlreadyFireBalled = true;
     }
@@ -394,12 +391,13 @@ void Golem::TriggerBossDefeat() {
     auto* skill = new Skill(mGame, Skill::SkillType::FireBall);
     skill->SetPosition(GetPosition());
 
-    auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(Vector2::UnitY);
-    blood->SetParticleSpeedScale(1.4);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 15.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = Vector2::UnitY;
+    blood.mSpeedScale = 1.4f;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(1.0);
@@ -480,12 +478,12 @@ void Golem::ReceiveHit(float damage, Vector2 knockBackDirection) {
     mFlashTimer = 0;
     mPlayerSpotted = true;
 
-    auto* blood = new ParticleSystem(mGame, 10, 170.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(knockBackDirection);
-    blood->SetParticleSpeedScale(1);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 10.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = knockBackDirection;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 12);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(0.3);
@@ -503,33 +501,33 @@ void Golem::ReceiveHit(float damage, Vector2 knockBackDirection) {
 void Golem::ManageAnimations() {
     if (mGolemState == State::Punch) {
         if (mIsInvulnerable) {
-            mDrawAnimatedComponent->SetAnimation("punchInvulnerable");
+            mDrawAnimatedComponent->SetAnimation(mPunchInvulnerableAnim);
         }
         else {
-            mDrawAnimatedComponent->SetAnimation("punch");
+            mDrawAnimatedComponent->SetAnimation(mPunchAnim);
         }
         mDrawAnimatedComponent->SetAnimFPS(10.0f / mPunchDuration);
     }
     else if (mGolemState == State::RunForward ||
              mGolemState == State::RunAway) {
         if (mIsInvulnerable) {
-            mDrawAnimatedComponent->SetAnimation("walkInvulnerable");
+            mDrawAnimatedComponent->SetAnimation(mWalkInvulnerableAnim);
         }
         else {
-            mDrawAnimatedComponent->SetAnimation("walk");
+            mDrawAnimatedComponent->SetAnimation(mWalkAnim);
         }
         mDrawAnimatedComponent->SetAnimFPS(mMoveSpeed / 40);
     }
     else if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
         mDrawAnimatedComponent->SetAnimFPS(4.0f / mHitDuration);
     }
     else {
         if (mIsInvulnerable) {
-            mDrawAnimatedComponent->SetAnimation("idleInvulnerable");
+            mDrawAnimatedComponent->SetAnimation(mIdleInvulnerableAnim);
         }
         else {
-            mDrawAnimatedComponent->SetAnimation("idle");
+            mDrawAnimatedComponent->SetAnimation(mIdleAnim);
         }
         mDrawAnimatedComponent->SetAnimFPS(10.0f);
     }
@@ -585,3 +583,8 @@ void Golem::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool Golem::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
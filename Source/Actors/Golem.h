@@ -29,6 +29,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Bosses are always created again on respawn, with a fresh fight
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void MovementAfterPlayerSpotted(float deltaTime);
     void MovementBeforePlayerSpotted();
@@ -88,6 +91,15 @@ private:
     // Atributos para sounds
     float mRunningSoundIntervalDuration;
     float mRunningSoundIntervalTimer;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mIdleAnim;
+    int mIdleInvulnerableAnim;
+    int mWalkAnim;
+    int mWalkInvulnerableAnim;
+    int mPunchAnim;
+    int mPunchInvulnerableAnim;
+    int mHitAnim;
 };
 
 
@@ -4,6 +4,7 @@
 
 #include "Ground.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawPolygonComponent.h"
@@ -18,6 +19,7 @@ Ground::Ground(Game* game, float width, float height, bool isSpike, bool isMovin
     ,mWidth(width)
     ,mIsSpike(isSpike)
     ,mIsMoving(isMoving)
+    ,mIsInTileCollision(false)
     ,mMovingTimer(movingDuration)
     ,mMovingDuration(movingDuration)
     ,mVelocity(velocity * mGame->GetScale())
@@ -64,11 +66,17 @@ void Ground::OnUpdate(float deltaTime) {
             mRigidBodyComponent->SetVelocity(mRigidBodyComponent->GetVelocity() * -1);
             mMovingTimer = 0;
         }
+        // Atualiza a célula do ground na grade de colisão
+        mGame->RefreshGround(this);
     }
 }
 
 void Ground::SetIsMoving(bool isMoving) {
     mIsMoving = isMoving;
+    // Ground que começa a se mover deixa de ser colisão estática
+    if (mIsMoving && mIsInTileCollision) {
+        mGame->RemoveGroundFromTileCollision(this);
+    }
     if (mIsMoving == true) {
         mRigidBodyComponent->SetVelocity(mVelocity);
     }
@@ -146,3 +154,18 @@ void Ground::ChangeResolution(float oldScale, float newScale) {
     }
     SetSprites();
 }
+
+bool Ground::SaveState(LevelSnapshot& snapshot) const
+{
+    Actor::SaveState(snapshot);
+    snapshot.Write(mIsMoving);
+    snapshot.Write(mMovingTimer);
+    return true;
+}
+
+void Ground::LoadState(LevelSnapshot& snapshot)
+{
+    Actor::LoadState(snapshot);
+    snapshot.Read(mIsMoving);
+    snapshot.Read(mMovingTimer);
+}
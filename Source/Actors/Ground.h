@@ -35,12 +35,22 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
+    class AABBComponent* GetAABBComponent() const { return mAABBComponent; }
+
+    // Whether this ground is baked into the game's TileCollisionLayer
+    void SetIsInTileCollision(bool isInTileCollision) { mIsInTileCollision = isInTileCollision; }
+    bool GetIsInTileCollision() const { return mIsInTileCollision; }
+
 protected:
     int mId;
     float mHeight;
     float mWidth;
     bool mIsSpike;
     bool mIsMoving;
+    bool mIsInTileCollision;
     float mMovingTimer;
     float mMovingDuration;
     Vector2 mStartingPosition;
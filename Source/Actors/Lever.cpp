@@ -8,6 +8,7 @@
 #include "Golem.h"
 #include "../Actors/Sword.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawPolygonComponent.h"
 #include "../Components/DrawComponents/DrawSpriteComponent.h"
@@ -24,6 +25,9 @@ Lever::Lever(class Game* game, float width, float height, LeverType leverType)
     ,mActivatingTimer(0.0f)
     ,mDrawSpriteComponent(nullptr)
     ,mDrawAnimatedComponent(nullptr)
+    ,mOffAnim(-1)
+    ,mActivatingAnim(-1)
+    ,mOnAnim(-1)
 
 {
     mDrawPolygonComponent = nullptr;
@@ -35,13 +39,13 @@ Lever::Lever(class Game* game, float width, float height, LeverType leverType)
                                            "../Assets/Sprites/Lever/Lever.json", 150);
 
         std::vector off = {0};
-        mDrawAnimatedComponent->AddAnimation("off", off);
+        mOffAnim = mDrawAnimatedComponent->AddAnimation("off", off);
 
         std::vector activating = {0, 1, 2, 3, 4, 5, 6, 6, 6, 6};
-        mDrawAnimatedComponent->AddAnimation("activating", activating);
+        mActivatingAnim = mDrawAnimatedComponent->AddAnimation("activating", activating);
 
         std::vector on = {6};
-        mDrawAnimatedComponent->AddAnimation("on", on);
+        mOnAnim = mDrawAnimatedComponent->AddAnimation("on", on);
 
         mDrawAnimatedComponent->SetAnimation("off");
         const float fps = 7.0f / mActivatingDuration;
@@ -81,7 +85,7 @@ void Lever::OnUpdate(float deltaTime) {
             }
         }
 
-        std::vector<FireBall* > fireBalls = mGame->GetFireBalls();
+        const std::vector<FireBall*>& fireBalls = mGame->GetFireBalls();
         for (FireBall* f: fireBalls) {
             if (!f->GetIsFromEnemy())
             if (mAABBComponent->Intersect(*f->GetComponent<AABBComponent>())) {
@@ -121,13 +125,13 @@ void Lever::OnUpdate(float deltaTime) {
         if (mLeverType == LeverType::Lever) {
             if (mActivatingTimer < mActivatingDuration) {
                 if (mDrawAnimatedComponent) {
-                    mDrawAnimatedComponent->SetAnimation("activating");
+                    mDrawAnimatedComponent->SetAnimation(mActivatingAnim);
                 }
                 mActivatingTimer += deltaTime;
             }
             else {
                 if (mDrawAnimatedComponent) {
-                    mDrawAnimatedComponent->SetAnimation("on");
+                    mDrawAnimatedComponent->SetAnimation(mOnAnim);
                 }
             }
         }
@@ -141,7 +145,6 @@ void Lever::OnUpdate(float deltaTime) {
 }
 
 void Lever::DynamicGroundTrigger() {
-    std::vector<Ground* > grounds = mGame->GetGrounds();
     switch (mEvent) {
         case Event::SetIsGrowing:
             for (int id : mGroundsIds) {
@@ -230,3 +233,22 @@ void Lever::ChangeResolution(float oldScale, float newScale) {
         mDrawPolygonComponent->SetVertices(vertices);
     }
 }
+
+bool Lever::SaveState(LevelSnapshot& snapshot) const
+{
+    Trigger::SaveState(snapshot);
+    snapshot.Write(mHealthPoints);
+    snapshot.Write(mSwordHit);
+    snapshot.Write(mActivate);
+    snapshot.Write(mActivatingTimer);
+    return true;
+}
+
+void Lever::LoadState(LevelSnapshot& snapshot)
+{
+    Trigger::LoadState(snapshot);
+    snapshot.Read(mHealthPoints);
+    snapshot.Read(mSwordHit);
+    snapshot.Read(mActivate);
+    snapshot.Read(mActivatingTimer);
+}
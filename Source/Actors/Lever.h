@@ -21,6 +21,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     void DynamicGroundTrigger() override;
     void EnemyTrigger() override;
@@ -34,4 +37,8 @@ private:
 
     class DrawSpriteComponent *mDrawSpriteComponent;
     class DrawAnimatedComponent *mDrawAnimatedComponent;
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mOffAnim;
+    int mActivatingAnim;
+    int mOnAnim;
 };
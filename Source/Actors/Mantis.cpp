@@ -5,8 +5,9 @@
 #include "Mantis.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
+#include "../LevelSnapshot.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DrawComponents/DrawSpriteComponent.h"
@@ -37,13 +38,13 @@ Mantis::Mantis(Game *game, float width, float height, float moveSpeed, float hea
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, 1.25f * mWidth, 1.25f * mHeight, "../Assets/Sprites/Mantis/Mantis.png", "../Assets/Sprites/Mantis/Mantis.json", 999);
     std::vector walk = {8, 9, 10, 11};
-    mDrawAnimatedComponent->AddAnimation("walk", walk);
+    mWalkAnim = mDrawAnimatedComponent->AddAnimation("walk", walk);
 
     std::vector attack = {1, 2, 3, 4, 5, 6, 7};
-    mDrawAnimatedComponent->AddAnimation("attack", attack);
+    mAttackAnim = mDrawAnimatedComponent->AddAnimation("attack", attack);
 
     std::vector hit = {0};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("walk");
     mDrawAnimatedComponent->SetAnimFPS(7.0f);
@@ -86,12 +87,13 @@ void Mantis::OnUpdate(float deltaTime) {
 
         mGame->GetCamera()->StartCameraShake(0.3, mCameraShakeStrength);
 
-        auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-        blood->SetPosition(GetPosition());
-        blood->SetEmitDirection(Vector2::UnitY);
-        blood->SetParticleSpeedScale(1.4);
-        blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-        blood->SetParticleGravity(true);
+        ParticleParams blood;
+        blood.mSize = 15.0f;
+        blood.mLifeTime = 3.0f;
+        blood.mDirection = Vector2::UnitY;
+        blood.mSpeedScale = 1.4f;
+        blood.mColor = SDL_Color{226, 90, 70, 255};
+        mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
         auto* circleBlur = new Effect(mGame);
         circleBlur->SetDuration(1.0);
@@ -213,14 +215,14 @@ void Mantis::Attack(float deltaTime) {
 
 void Mantis::ManageAnimations() {
     if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
     }
     else if (mMantisState == State::Attack) {
         mDrawAnimatedComponent->SetAnimFPS(10.0f);
-        mDrawAnimatedComponent->SetAnimation("attack");
+        mDrawAnimatedComponent->SetAnimation(mAttackAnim);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("walk");
+        mDrawAnimatedComponent->SetAnimation(mWalkAnim);
     }
 }
 
@@ -263,7 +265,25 @@ void Mantis::ChangeResolution(float oldScale, float newScale) {
     }
 }
 
+bool Mantis::SaveState(LevelSnapshot& snapshot) const
+{
+    Enemy::SaveState(snapshot);
+    snapshot.Write(mMantisState);
+    snapshot.Write(mWalkingAroundTimer);
+    snapshot.Write(mWalkingAroundMoveSpeed);
+    snapshot.Write(mAttackTimer);
+    snapshot.Write(mWalkBackTimer);
+    snapshot.Write(mWaitToAttackTimer);
+    return true;
+}
 
-
-
-
+void Mantis::LoadState(LevelSnapshot& snapshot)
+{
+    Enemy::LoadState(snapshot);
+    snapshot.Read(mMantisState);
+    snapshot.Read(mWalkingAroundTimer);
+    snapshot.Read(mWalkingAroundMoveSpeed);
+    snapshot.Read(mAttackTimer);
+    snapshot.Read(mWalkBackTimer);
+    snapshot.Read(mWaitToAttackTimer);
+}
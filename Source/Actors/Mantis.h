@@ -15,6 +15,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
     enum class State
     {
@@ -46,4 +49,9 @@ private:
     float mWalkBackTimer;
     float mWaitToAttackDuration;
     float mWaitToAttackTimer;
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mWalkAnim;
+    int mAttackAnim;
+    int mHitAnim;
 };
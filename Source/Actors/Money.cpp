@@ -73,19 +73,17 @@ Money::Money(class Game *game, MoneyType type)
 
     mAABBComponent = new AABBComponent(this, v1, v3);
 
+    // Começa livre no pool
     Deactivate();
-
-    mGame->AddMoney(this);
 }
 
 Money::~Money() {
-    mGame->RemoveMoney(this);
 }
 
 void Money::OnUpdate(float deltaTime) {
     Activate();
     // Colisão entre moneys
-    std::vector<Money*> moneys = mGame->GetMoneys();
+    const std::vector<Money*>& moneys = mGame->GetMoneys();
     if (!moneys.empty()) {
         for (Money* m: moneys) {
             if (m != this) {
@@ -148,6 +146,7 @@ void Money::Activate() {
 
 void Money::Deactivate() {
     SetState(ActorState::Paused);
+    mGame->GetMoneyPool().Release(this);
     mMoneyState = State::FlyingOut;
     SetRotation(Random::GetFloatRange(Math::Pi, Math::TwoPi));
     mRigidBodyComponent->SetVelocity(GetForward() * mFlySpeed);
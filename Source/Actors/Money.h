@@ -5,8 +5,9 @@
 #pragma once
 
 #include "Actor.h"
+#include "../ObjectPool.h"
 
-class Money : public Actor
+class Money : public Actor, public Pooled<Money>
 {
 public:
     enum class MoneyType {
@@ -5,7 +5,7 @@
 #include "Moth.h"
 #include "Actor.h"
 #include "Effect.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "Projectile.h"
 #include "Skill.h"
 #include "../Game.h"
@@ -70,19 +70,19 @@ Moth::Moth(Game *game, float width, float height, float moveSpeed, float healthP
 
     mDrawAnimatedComponent = new DrawAnimatedComponent(this, mWidth * 2.0f, mHeight * 2.0f, "../Assets/Sprites/FinalBoss/FinalBoss.png", "../Assets/Sprites/FinalBoss/FinalBoss.json", 999);
     std::vector idle = {53, 54, 55, 56, 57, 58, 59, 60};
-    mDrawAnimatedComponent->AddAnimation("idle", idle);
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", idle);
 
     std::vector attack = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
-    mDrawAnimatedComponent->AddAnimation("attack", attack);
+    mAttackAnim = mDrawAnimatedComponent->AddAnimation("attack", attack);
 
     std::vector boostUp = {14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35};
-    mDrawAnimatedComponent->AddAnimation("boostUp", boostUp);
+    mBoostUpAnim = mDrawAnimatedComponent->AddAnimation("boostUp", boostUp);
 
     std::vector die = {36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48};
-    mDrawAnimatedComponent->AddAnimation("die", die);
+    mDieAnim = mDrawAnimatedComponent->AddAnimation("die", die);
 
     std::vector hit = {49, 50, 51, 52};
-    mDrawAnimatedComponent->AddAnimation("hit", hit);
+    mHitAnim = mDrawAnimatedComponent->AddAnimation("hit", hit);
 
     mDrawAnimatedComponent->SetAnimation("idle");
     mDrawAnimatedComponent->SetAnimFPS(10.0f);
@@ -109,7 +109,7 @@ void Moth::OnUpdate(float deltaTime) {
     }
 
     // Revida bola de fogo
-    std::vector<FireBall*> fireBalls = mGame->GetFireBalls();
+    const std::vector<FireBall*>& fireBalls = mGame->GetFireBalls();
     if (!fireBalls.empty()) {
         for (FireBall* f : fireBalls) {
             if ((GetPosition() - f->GetPosition()).Length() < 150 * mGame->GetScale()) {
@@ -308,24 +308,21 @@ void Moth::Projectiles(float deltaTime) {
             direction = Math::Pi * (1 - static_cast<float>(mCountProjectiles) / mMaxProjectiles);
         }
 
-        std::vector<Projectile* > projectiles = mGame->GetProjectiles();
-        for (Projectile* p: projectiles) {
-            if (p->GetState() == ActorState::Paused && p->GetProjectileType() == Projectile::ProjectileType::OrangeBall) {
-                p->SetState(ActorState::Active);
-                p->SetRotation(direction);
-                p->SetWidth(mProjectileWidth);
-                p->SetHeight(mProjectileHeight);
-                if (mIsSlowMotion) {
-                    p->SetSpeed(2 * mProjectileSpeed);
-                }
-                else {
-                    p->SetSpeed(mProjectileSpeed);
-                }
-                p->SetDamage(15);
-                p->SetPosition(GetPosition());
-                p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
-                break;
+        Projectile* p = mGame->GetProjectilePool().Acquire(static_cast<int>(Projectile::ProjectileType::OrangeBall));
+        if (p) {
+            p->SetState(ActorState::Active);
+            p->SetRotation(direction);
+            p->SetWidth(mProjectileWidth);
+            p->SetHeight(mProjectileHeight);
+            if (mIsSlowMotion) {
+                p->SetSpeed(2 * mProjectileSpeed);
+            }
+            else {
+                p->SetSpeed(mProjectileSpeed);
             }
+            p->SetDamage(15);
+            p->SetPosition(GetPosition());
+            p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
         }
         mCountProjectiles++;
     }
@@ -369,19 +366,16 @@ void Moth::SlowMotionProjectiles(float deltaTime) {
             direction = Math::Pi * (1 - static_cast<float>(mCountProjectiles) / mMaxProjectiles);
         }
 
-        std::vector<Projectile* > projectiles = mGame->GetProjectiles();
-        for (Projectile* p: projectiles) {
-            if (p->GetState() == ActorState::Paused && p->GetProjectileType() == Projectile::ProjectileType::OrangeBall) {
-                p->SetState(ActorState::Active);
-                p->SetRotation(direction);
-                p->SetWidth(mProjectileWidth);
-                p->SetHeight(mProjectileHeight);
-                p->SetSpeed(mProjectileSpeed * 2);
-                p->SetDamage(15);
-                p->SetPosition(GetPosition());
-                p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
-                break;
-            }
+        Projectile* p = mGame->GetProjectilePool().Acquire(static_cast<int>(Projectile::ProjectileType::OrangeBall));
+        if (p) {
+            p->SetState(ActorState::Active);
+            p->SetRotation(direction);
+            p->SetWidth(mProjectileWidth);
+            p->SetHeight(mProjectileHeight);
+            p->SetSpeed(mProjectileSpeed * 2);
+            p->SetDamage(15);
+            p->SetPosition(GetPosition());
+            p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
         }
         mCountProjectiles++;
     }
@@ -416,24 +410,21 @@ void Moth::CircleProjectiles(float deltaTime) {
 
     for (; mCountCircleProjectiles < mMaxCircleProjectiles; mCountCircleProjectiles++) {
         float direction = Math::TwoPi * (1.0f - static_cast<float>(mCountCircleProjectiles) / (mMaxCircleProjectiles));
-        std::vector<Projectile* > projectiles = mGame->GetProjectiles();
-        for (Projectile* p: projectiles) {
-            if (p->GetState() == ActorState::Paused && p->GetProjectileType() == Projectile::ProjectileType::OrangeBall) {
-                p->SetState(ActorState::Active);
-                p->SetRotation(direction);
-                p->SetWidth(mCircleProjectileWidth);
-                p->SetHeight(mCircleProjectileHeight);
-                if (mIsSlowMotion) {
-                    p->SetSpeed(1.5f * mCircleProjectileSpeed);
-                }
-                else {
-                    p->SetSpeed(mCircleProjectileSpeed);
-                }
-                p->SetDamage(15);
-                p->SetPosition(GetPosition());
-                p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
-                break;
+        Projectile* p = mGame->GetProjectilePool().Acquire(static_cast<int>(Projectile::ProjectileType::OrangeBall));
+        if (p) {
+            p->SetState(ActorState::Active);
+            p->SetRotation(direction);
+            p->SetWidth(mCircleProjectileWidth);
+            p->SetHeight(mCircleProjectileHeight);
+            if (mIsSlowMotion) {
+                p->SetSpeed(1.5f * mCircleProjectileSpeed);
             }
+            else {
+                p->SetSpeed(mCircleProjectileSpeed);
+            }
+            p->SetDamage(15);
+            p->SetPosition(GetPosition());
+            p->GetComponent<DrawAnimatedComponent>()->UseRotation(true);
         }
     }
 }
@@ -487,8 +478,6 @@ void Moth::Dying(float deltaTime) {
 
 
 void Moth::ChangeGround(float deltaTime) {
-    std::vector<Ground *> grounds = mGame->GetGrounds();
-
     if (mHealthPoints > 0.6f * mMaxHealthPoints && mHealthPoints <= 0.9f * mMaxHealthPoints) {
         // for (int id : {174, 176}) {
         for (int id : {16, 17}) {
@@ -542,12 +531,13 @@ void Moth::TriggerBossDefeat() {
     auto* skill = new Skill(mGame, Skill::SkillType::TimeControl);
     skill->SetPosition(GetPosition());
 
-    auto* blood = new ParticleSystem(mGame, 15, 300.0, 3.0, 0.07f);
-    blood->SetPosition(GetPosition());
-    blood->SetEmitDirection(Vector2::UnitY);
-    blood->SetParticleSpeedScale(1.4);
-    blood->SetParticleColor(SDL_Color{226, 90, 70, 255});
-    blood->SetParticleGravity(true);
+    ParticleParams blood;
+    blood.mSize = 15.0f;
+    blood.mLifeTime = 3.0f;
+    blood.mDirection = Vector2::UnitY;
+    blood.mSpeedScale = 1.4f;
+    blood.mColor = SDL_Color{226, 90, 70, 255};
+    mGame->GetParticles()->Emit(blood, GetPosition(), 21);
 
     auto* circleBlur = new Effect(mGame);
     circleBlur->SetDuration(1.0);
@@ -562,23 +552,23 @@ void Moth::TriggerBossDefeat() {
 
 void Moth::ManageAnimations() {
     if (mAttackAnimation) {
-        mDrawAnimatedComponent->SetAnimation("attack");
+        mDrawAnimatedComponent->SetAnimation(mAttackAnim);
         mDrawAnimatedComponent->SetAnimFPS(10.0f / mAttackDuration);
     }
     else if (mMothState == State::BoostUp) {
-        mDrawAnimatedComponent->SetAnimation("boostUp");
+        mDrawAnimatedComponent->SetAnimation(mBoostUpAnim);
         mDrawAnimatedComponent->SetAnimFPS(22.0f / mBoostUpDuration);
     }
     else if (mMothState == State::Dying) {
-        mDrawAnimatedComponent->SetAnimation("die");
+        mDrawAnimatedComponent->SetAnimation(mDieAnim);
         mDrawAnimatedComponent->SetAnimFPS(13.0f / mDyingDuration);
     }
     else if (mIsFlashing) {
-        mDrawAnimatedComponent->SetAnimation("hit");
+        mDrawAnimatedComponent->SetAnimation(mHitAnim);
         mDrawAnimatedComponent->SetAnimFPS(4.0f / mHitDuration);
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("idle");
+        mDrawAnimatedComponent->SetAnimation(mIdleAnim);
         mDrawAnimatedComponent->SetAnimFPS(10.0f);
     }
 
@@ -595,21 +585,21 @@ void Moth::ManageAnimations() {
 
     // if (mMothState == State::Projectiles || mMothState == State::SlowMotionProjectiles) {
     // if (mAttackAnimation) {
-    //     mDrawAnimatedComponent->SetAnimation("attack");
+    //     mDrawAnimatedComponent->SetAnimation(mAttackAnim);
     //     mDrawAnimatedComponent->SetAnimFPS(10.0f / mAttackDuration);
     // }
     // else if (mMothState != State::BoostUp) {
-    //     mDrawAnimatedComponent->SetAnimation("idle");
+    //     mDrawAnimatedComponent->SetAnimation(mIdleAnim);
     //     mDrawAnimatedComponent->SetAnimFPS(10.0f);
     // }
     //
     // if (mIsFlashing) {
-    //     mDrawAnimatedComponent->SetAnimation("hit");
+    //     mDrawAnimatedComponent->SetAnimation(mHitAnim);
     //     mDrawAnimatedComponent->SetAnimFPS(4.0f / mHitDuration);
     // }
     //
     // if (mMothState == State::BoostUp) {
-    //     mDrawAnimatedComponent->SetAnimation("boostUp");
+    //     mDrawAnimatedComponent->SetAnimation(mBoostUpAnim);
     //     mDrawAnimatedComponent->SetAnimFPS(22.0f / mBoostUpDuration);
     // }
 
@@ -653,6 +643,7 @@ void Moth::ChangeResolution(float oldScale, float newScale) {
     }
 }
 
-
-
-
+bool Moth::SaveState(LevelSnapshot& snapshot) const
+{
+    return false;
+}
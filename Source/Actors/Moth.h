@@ -25,6 +25,9 @@ public:
 
     void ChangeResolution(float oldScale, float newScale) override;
 
+    // Bosses are always created again on respawn, with a fresh fight
+    bool SaveState(class LevelSnapshot& snapshot) const override;
+
 private:
     void MovementAfterPlayerSpotted(float deltaTime);
     void MovementBeforePlayerSpotted();
@@ -86,5 +89,12 @@ private:
     float mFlyUpTimer;
 
 
+
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mIdleAnim;
+    int mAttackAnim;
+    int mBoostUpAnim;
+    int mDieAnim;
+    int mHitAnim;
 };
 
@@ -8,7 +8,7 @@
 #include "../Game.h"
 #include "../Actors/Sword.h"
 #include "../Actors/FireBall.h"
-#include "../Actors/ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
 #include "../Components/DashComponent.h"
@@ -164,37 +164,37 @@ Player::Player(Game* game, float width, float height)
                                                    "../Assets/Sprites/Esquilo2/Esquilo.json", 1000);
 
     std::vector idle = {13};
-    mDrawAnimatedComponent->AddAnimation("idle", idle);
+    mIdleAnim = mDrawAnimatedComponent->AddAnimation("idle", idle);
 
     std::vector attackFront = {13, 0, 1};
-    mDrawAnimatedComponent->AddAnimation("attackFront", attackFront);
+    mAttackFrontAnim = mDrawAnimatedComponent->AddAnimation("attackFront", attackFront);
 
     std::vector attackUp = {2, 3};
-    mDrawAnimatedComponent->AddAnimation("attackUp", attackUp);
+    mAttackUpAnim = mDrawAnimatedComponent->AddAnimation("attackUp", attackUp);
 
     std::vector dash = {4, 5, 5, 5, 6};
-    mDrawAnimatedComponent->AddAnimation("dash", dash);
+    mDashAnim = mDrawAnimatedComponent->AddAnimation("dash", dash);
 
     std::vector run = {17, 18, 19, 20, 21, 22};
-    mDrawAnimatedComponent->AddAnimation("run", run);
+    mRunAnim = mDrawAnimatedComponent->AddAnimation("run", run);
 
     std::vector flash = {10};
-    mDrawAnimatedComponent->AddAnimation("flash", flash);
+    mFlashAnim = mDrawAnimatedComponent->AddAnimation("flash", flash);
 
     std::vector hurt = {11, 12};
-    mDrawAnimatedComponent->AddAnimation("hurt", hurt);
+    mHurtAnim = mDrawAnimatedComponent->AddAnimation("hurt", hurt);
 
     std::vector die = {11, 7, 8, 9, 9, 9};
-    mDrawAnimatedComponent->AddAnimation("die", die);
+    mDieAnim = mDrawAnimatedComponent->AddAnimation("die", die);
 
     std::vector jumpUp = {14};
-    mDrawAnimatedComponent->AddAnimation("jumpUp", jumpUp);
+    mJumpUpAnim = mDrawAnimatedComponent->AddAnimation("jumpUp", jumpUp);
 
     std::vector jumpApex = {15};
-    mDrawAnimatedComponent->AddAnimation("jumpApex", jumpApex);
+    mJumpApexAnim = mDrawAnimatedComponent->AddAnimation("jumpApex", jumpApex);
 
     std::vector falling = {16};
-    mDrawAnimatedComponent->AddAnimation("falling", falling);
+    mFallingAnim = mDrawAnimatedComponent->AddAnimation("falling", falling);
 
     mDrawAnimatedComponent->SetAnimation("idle");
     mDrawAnimatedComponent->SetAnimFPS(10.0f);
@@ -449,21 +449,18 @@ void Player::OnProcessInput(const uint8_t* state, SDL_GameController &controller
             mFireBallCooldownTimer >= mFireBallCooldownDuration &&
             mMana >= mFireballManaCost)
         {
-            std::vector<FireBall* > fireBalls = mGame->GetFireBalls();
-            for (FireBall* f: fireBalls) {
-                if (f->GetState() == ActorState::Paused) {
-                    f->SetState(ActorState::Active);
-                    f->SetRotation(GetRotation());
-                    f->SetWidth(mFireballWidth);
-                    f->SetHeight(mFireBallHeight);
-                    f->SetSpeed(mFireballSpeed);
-                    f->SetDamage(mFireballDamage);
-                    f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
-                    mIsFireAttacking = true;
-                    mStopInAirFireBallTimer = 0;
-                    mMana -= mFireballManaCost;
-                    break;
-                }
+            FireBall* f = mGame->GetFireBallPool().Acquire();
+            if (f) {
+                f->SetState(ActorState::Active);
+                f->SetRotation(GetRotation());
+                f->SetWidth(mFireballWidth);
+                f->SetHeight(mFireBallHeight);
+                f->SetSpeed(mFireballSpeed);
+                f->SetDamage(mFireballDamage);
+                f->SetPosition(GetPosition() + f->GetForward() * (f->GetWidth() / 2));
+                mIsFireAttacking = true;
+                mStopInAirFireBallTimer = 0;
+                mMana -= mFireballManaCost;
             }
             // Inicia cooldown
             mFireBallCooldownTimer = 0;
@@ -646,12 +643,27 @@ void Player::OnUpdate(float deltaTime) {
 
 void Player::ResolveGroundCollision() {
     std::array<bool, 4> collisionSide{};
-    std::vector<Ground* > grounds = mGame->GetGrounds();
+    // Durante o dash o player anda rápido o bastante para atravessar grounds finos
+    if (mDashComponent->GetIsDashing()) {
+        mAABBComponent->SetCollisionMode(CollisionMode::Swept);
+    }
+    else {
+        mAABBComponent->SetCollisionMode(CollisionMode::Discrete);
+    }
+
+    // Busca grounds perto do caminho do player e da espada
+    AABBComponent* swordAABB = mSword->GetComponent<AABBComponent>();
+    Vector2 queryMin(Math::Min(mAABBComponent->GetSweptMin().x, swordAABB->GetWorldMin().x),
+                     Math::Min(mAABBComponent->GetSweptMin().y, swordAABB->GetWorldMin().y));
+    Vector2 queryMax(Math::Max(mAABBComponent->GetSweptMax().x, swordAABB->GetWorldMax().x),
+                     Math::Max(mAABBComponent->GetSweptMax().y, swordAABB->GetWorldMax().y));
+    std::vector<Ground* > grounds;
+    mGame->QueryGrounds(queryMin, queryMax, grounds);
     if (!grounds.empty()) {
         for (Ground* g: grounds) {
             if (!g->GetIsSpike()) { // Colisão com ground
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                if (mAABBComponent->IntersectSwept(*g->GetAABBComponent())) {
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
                 }
                 else {
                     collisionSide = {false, false, false, false};
@@ -751,32 +763,35 @@ void Player::ResolveGroundCollision() {
                     }
                 }
 
-                if (mSword->GetComponent<AABBComponent>()->Intersect(*g->GetComponent<AABBComponent>())) {
+                if (mSword->GetComponent<AABBComponent>()->Intersect(*g->GetAABBComponent())) {
                     // Colisão da sword com grounds
                     if (!mSwordHitGround) {
-                        collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetComponent<AABBComponent>());
+                        collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetAABBComponent());
                         if ((collisionSide[0] && Math::Abs(mSword->GetForward().y) == 1) ||
                             (collisionSide[1] && Math::Abs(mSword->GetForward().y) == 1) ||
                             (collisionSide[2] && Math::Abs(mSword->GetForward().x) == 1) ||
                             (collisionSide[3] && Math::Abs(mSword->GetForward().x) == 1) )
                         {
-                            auto* grass = new ParticleSystem(mGame, 6, 150.0, 0.30, 0.05f);
+                            ParticleParams grass;
+                            grass.mSize = 6.0f;
+                            grass.mLifeTime = 0.30f;
+                            Vector2 grassPosition = mSword->GetPosition();
                             if (collisionSide[0]) {
-                                grass->SetPosition(Vector2(mSword->GetPosition().x, g->GetPosition().y - g->GetHeight() / 2));
+                                grassPosition = Vector2(mSword->GetPosition().x, g->GetPosition().y - g->GetHeight() / 2);
                             }
                             if (collisionSide[1]) {
-                                grass->SetPosition(Vector2(mSword->GetPosition().x, g->GetPosition().y + g->GetHeight() / 2));
+                                grassPosition = Vector2(mSword->GetPosition().x, g->GetPosition().y + g->GetHeight() / 2);
                             }
                             if (collisionSide[2]) {
-                                grass->SetPosition(Vector2(g->GetPosition().x - g->GetWidth() / 2, GetPosition().y));
+                                grassPosition = Vector2(g->GetPosition().x - g->GetWidth() / 2, GetPosition().y);
                             }
                             if (collisionSide[3]) {
-                                grass->SetPosition(Vector2(g->GetPosition().x + g->GetWidth() / 2, GetPosition().y));
+                                grassPosition = Vector2(g->GetPosition().x + g->GetWidth() / 2, GetPosition().y);
                             }
 
-                            grass->SetEmitDirection(mSword->GetForward() * -1);
-                            grass->SetIsSplash(true);
-                            grass->SetParticleSpeedScale(0.5);
+                            grass.mDirection = mSword->GetForward() * -1;
+                            grass.mIsSplash = true;
+                            grass.mSpeedScale = 0.5f;
                             SDL_Color color;
                             switch (mGame->GetGameScene()) {
                                 case Game::GameScene::LevelTeste:
@@ -807,15 +822,15 @@ void Player::ResolveGroundCollision() {
                                     color = {80, 148, 45, 255};
                                     break;
                             }
-                            grass->SetParticleColor(color);
-                            grass->SetParticleGravity(true);
+                            grass.mColor = color;
+                            mGame->GetParticles()->Emit(grass, grassPosition, 7);
                             mSwordHitGround = true;
                         }
                     }
                 }
             }
             else if (g->GetIsSpike()) { // Colisão com spikes
-                if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
+                if (mAABBComponent->IntersectSwept(*g->GetAABBComponent())) {
                     // SetPosition(mStartingPosition);
 
                     // mGame->mResetLevel = true;
@@ -824,7 +839,7 @@ void Player::ResolveGroundCollision() {
                     // SetPosition(g->GetRespawPosition());
                     // ReceiveHit(10, Vector2::Zero);
 
-                    collisionSide = mAABBComponent->ResolveCollision(*g->GetComponent<AABBComponent>());
+                    collisionSide = mAABBComponent->ResolveCollision(*g->GetAABBComponent());
 
                     mDashComponent->StopDash();
 
@@ -850,9 +865,9 @@ void Player::ResolveGroundCollision() {
 
                     mKnockBackTimer = 0;
                 }
-                else if (mSword->GetComponent<AABBComponent>()->Intersect(*g->GetComponent<AABBComponent>())) { // Colisão da sword com spikes
+                else if (mSword->GetComponent<AABBComponent>()->Intersect(*g->GetAABBComponent())) { // Colisão da sword com spikes
                     if (!mSwordHitSpike) {
-                        collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetComponent<AABBComponent>());
+                        collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetAABBComponent());
                         if ((collisionSide[0] && Math::Abs(mSword->GetForward().y) == 1) ||
                             (collisionSide[1] && Math::Abs(mSword->GetForward().y) == 1) ||
                             (collisionSide[2] && Math::Abs(mSword->GetForward().x) == 1) ||
@@ -863,7 +878,7 @@ void Player::ResolveGroundCollision() {
                                 auto* sparkEffect = new Effect(mGame);
                                 sparkEffect->SetDuration(0.1f);
 
-                                collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetComponent<AABBComponent>());
+                                collisionSide = mSword->GetComponent<AABBComponent>()->CollisionSide(*g->GetAABBComponent());
                                 if (collisionSide[0]) {
                                     sparkEffect->SetPosition(Vector2(mSword->GetPosition().x, g->GetPosition().y - g->GetHeight() / 2));
                                 }
@@ -958,45 +973,45 @@ void Player::ResolveEnemyCollision() {
 void Player::ManageAnimations() {
     mDrawAnimatedComponent->SetAnimFPS(10.0f);
     if (mIsDead) {
-        mDrawAnimatedComponent->SetAnimation("die");
+        mDrawAnimatedComponent->SetAnimation(mDieAnim);
         mDrawAnimatedComponent->SetAnimFPS(4.0f / mDeathAnimationDuration);
     }
     else if (mHurtTimer < mHurtDuration) {
-        mDrawAnimatedComponent->SetAnimation("hurt");
+        mDrawAnimatedComponent->SetAnimation(mHurtAnim);
     }
     else if (mDashComponent->GetIsDashing()) {
-        mDrawAnimatedComponent->SetAnimation("dash");
+        mDrawAnimatedComponent->SetAnimation(mDashAnim);
     }
     else if (mSword->GetState() == ActorState::Active) {
         if (mSwordDirection == 3 * Math::Pi / 2) {
-            mDrawAnimatedComponent->SetAnimation("attackUp");
+            mDrawAnimatedComponent->SetAnimation(mAttackUpAnim);
         }
         if (mSwordDirection == Math::Pi / 2) {
-            mDrawAnimatedComponent->SetAnimation("attackFront");
+            mDrawAnimatedComponent->SetAnimation(mAttackFrontAnim);
         }
         if (mSwordDirection == 0 || mSwordDirection == Math::Pi) {
-            mDrawAnimatedComponent->SetAnimation("attackFront");
+            mDrawAnimatedComponent->SetAnimation(mAttackFrontAnim);
         }
         mDrawAnimatedComponent->SetAnimFPS(3.0f / 0.15f);
     }
     else if (mIsRunning && mIsOnGround) {
-        mDrawAnimatedComponent->SetAnimation("run");
+        mDrawAnimatedComponent->SetAnimation(mRunAnim);
     }
     else if (!mIsOnGround && !mIsWallSliding) {
         if (mRigidBodyComponent->GetVelocity().y < -200 * mGame->GetScale()) {
-            mDrawAnimatedComponent->SetAnimation("jumpUp");
+            mDrawAnimatedComponent->SetAnimation(mJumpUpAnim);
         }
         if (mRigidBodyComponent->GetVelocity().y > 200 * mGame->GetScale()) {
-            mDrawAnimatedComponent->SetAnimation("falling");
+            mDrawAnimatedComponent->SetAnimation(mFallingAnim);
         }
         if (mRigidBodyComponent->GetVelocity().y > -200 * mGame->GetScale() &&
             mRigidBodyComponent->GetVelocity().y < 200 * mGame->GetScale())
         {
-            mDrawAnimatedComponent->SetAnimation("jumpApex");
+            mDrawAnimatedComponent->SetAnimation(mJumpApexAnim);
         }
     }
     else {
-        mDrawAnimatedComponent->SetAnimation("idle");
+        mDrawAnimatedComponent->SetAnimation(mIdleAnim);
     }
 
     if (mIsInvulnerable && mHurtTimer > mHurtDuration) {
@@ -197,6 +197,19 @@ private:
     class DrawSpriteComponent* mDrawSpriteComponent;
     class DrawAnimatedComponent* mDrawAnimatedComponent;
 
+    // Animation clips, resolved once so ManageAnimations does no string lookups
+    int mIdleAnim;
+    int mAttackFrontAnim;
+    int mAttackUpAnim;
+    int mDashAnim;
+    int mRunAnim;
+    int mFlashAnim;
+    int mHurtAnim;
+    int mDieAnim;
+    int mJumpUpAnim;
+    int mJumpApexAnim;
+    int mFallingAnim;
+
     class RigidBodyComponent* mRigidBodyComponent;
     class AABBComponent* mAABBComponent;
     class DashComponent* mDashComponent;
@@ -3,7 +3,7 @@
 //
 
 #include "Projectile.h"
-#include "ParticleSystem.h"
+#include "../ParticleEngine.h"
 #include "../Game.h"
 #include "../Components/RigidBodyComponent.h"
 #include "../Components/AABBComponent.h"
@@ -63,12 +63,17 @@ Projectile::Projectile(class Game *game, ProjectileType type, float width, float
 
     mRigidBodyComponent = new RigidBodyComponent(this, 1, 40000, 1800);
     mAABBComponent = new AABBComponent(this, v1, v3);
+    // Rápido o bastante para atravessar grounds finos entre dois frames
+    mAABBComponent->SetCollisionMode(CollisionMode::Swept);
 
-    mGame->AddProjectile(this);
+    // Começa livre no pool, sem a explosão do Deactivate
+    SetState(ActorState::Paused);
+    mDurationTimer = 0;
+    mAABBComponent->SetActive(false);
+    mDrawAnimatedComponent->SetIsVisible(false);
 }
 
 Projectile::~Projectile() {
-    mGame->RemoveProjectile(this);
 }
 
 void Projectile::OnUpdate(float deltaTime) {
@@ -84,18 +89,18 @@ void Projectile::OnUpdate(float deltaTime) {
 }
 
 void Projectile::ExplosionEffect() {
-    auto* explosion = new ParticleSystem(mGame, 12, 200.0, 0.2, 0.07f);
-    explosion->SetPosition(GetPosition() + GetForward() * (mWidth / 2));
-    explosion->SetEmitDirection(Vector2::Zero);
-    explosion->SetIsSplash(true);
-    explosion->SetParticleSpeedScale(1);
+    ParticleParams explosion;
+    explosion.mSize = 12.0f;
+    explosion.mLifeTime = 0.2f;
+    explosion.mIsSplash = true;
     if (mProjectileType == ProjectileType::Acid) {
-        explosion->SetParticleColor(SDL_Color{208, 232, 92, 255});
+        explosion.mColor = SDL_Color{208, 232, 92, 255};
     }
     if (mProjectileType == ProjectileType::OrangeBall) {
-        explosion->SetParticleColor(SDL_Color{218, 147, 16, 255});
+        explosion.mColor = SDL_Color{218, 147, 16, 255};
     }
-    explosion->SetParticleGravity(false);
+    explosion.mGravity = false;
+    mGame->GetParticles()->Emit(explosion, GetPosition() + GetForward() * (mWidth / 2), 14);
 }
 
 void Projectile::Activate() {
@@ -133,6 +138,7 @@ void Projectile::Activate() {
 
 void Projectile::Deactivate() {
     SetState(ActorState::Paused);
+    mGame->GetProjectilePool().Release(this);
     mRigidBodyComponent->SetVelocity(Vector2::Zero);
     mDurationTimer = 0;
     mAABBComponent->SetActive(false); // desativa colisão
@@ -150,14 +156,8 @@ void Projectile::Deactivate() {
 }
 
 void Projectile::ResolveGroundCollision() {
-    std::vector<Ground*> grounds;
-    grounds = mGame->GetGrounds();
-    if (!grounds.empty()) {
-        for (Ground* g : grounds) {
-            if (mAABBComponent->Intersect(*g->GetComponent<AABBComponent>())) {
-                Deactivate();
-            }
-        }
+    if (mGame->CollidesWithGround(mAABBComponent)) {
+        Deactivate();
     }
 }
 
@@ -5,8 +5,9 @@
 #pragma once
 
 #include "Actor.h"
+#include "../ObjectPool.h"
 
-class Projectile : public Actor
+class Projectile : public Actor, public Pooled<Projectile>
 {
 public:
     enum class ProjectileType {
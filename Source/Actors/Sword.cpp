@@ -42,10 +42,10 @@ Sword::Sword(class Game *game, Actor *owner, float width, float height, float du
                                                        swordAssets + "SwordSlash.json", 1001);
 
     const std::vector slash = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 9, 9, 9};
-    mDrawAnimatedComponent->AddAnimation("slash", slash);
+    mSlashAnim = mDrawAnimatedComponent->AddAnimation("slash", slash);
 
     const std::vector end = {9};
-    mDrawAnimatedComponent->AddAnimation("end", end);
+    mEndAnim = mDrawAnimatedComponent->AddAnimation("end", end);
 
     mDrawAnimatedComponent->SetAnimation("end");
     const float fps = 9.0f / mDuration;
@@ -149,7 +149,7 @@ void Sword::Activate()
 
     if (mDrawAnimatedComponent) {
         mDrawAnimatedComponent->SetIsVisible(true);
-        mDrawAnimatedComponent->SetAnimation("slash");
+        mDrawAnimatedComponent->SetAnimation(mSlashAnim);
     }
 }
 
@@ -167,7 +167,7 @@ void Sword::Deactivate()
 
     if (mDrawAnimatedComponent) {
         mDrawAnimatedComponent->SetIsVisible(false);
-        mDrawAnimatedComponent->SetAnimation("end");
+        mDrawAnimatedComponent->SetAnimation(mEndAnim);
     }
     mDurationTimer = 0;
 }
@@ -38,6 +38,9 @@ private:
     class DrawPolygonComponent *mDrawPolygonComponent;
     class DrawSpriteComponent *mDrawSpriteComponent;
     class DrawAnimatedComponent *mDrawAnimatedComponent;
+    // Animation clips, resolved once so per-frame code does no string lookups
+    int mSlashAnim;
+    int mEndAnim;
 
     class RigidBodyComponent *mRigidBodyComponent;
     class AABBComponent *mAABBComponent;
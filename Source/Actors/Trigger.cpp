@@ -258,7 +258,6 @@ void Trigger::CameraTrigger() {
 }
 
 void Trigger::DynamicGroundTrigger() {
-    std::vector<Ground *> grounds = mGame->GetGrounds();
     std::vector<Enemy *> enemies = mGame->GetEnemies();
     bool allEnemiesDie = true;
     switch (mEvent) {
@@ -309,7 +308,6 @@ void Trigger::DynamicGroundTrigger() {
 }
 
 void Trigger::GroundTrigger() {
-    std::vector<Ground *> grounds = mGame->GetGrounds();
     switch (mEvent) {
         case Event::SetIsMoving:
             for (int id : mGroundsIds) {
@@ -8,7 +8,8 @@ SoundHandle SoundHandle::Invalid;
 
 // Create the AudioSystem with specified number of channels
 // (Defaults to 8 channels)
-AudioSystem::AudioSystem(int numChannels)
+AudioSystem::AudioSystem(int numChannels, bool isDummy)
+	:mIsDummy(isDummy)
 {
     // --------------
     // TODO - PARTE 4
@@ -16,13 +17,15 @@ AudioSystem::AudioSystem(int numChannels)
 
     // TODO 1.: Inicialize a SDL_mixer com a taxa de amostragem de 44100 Hz, formato padrão, 2 canais (estéreo) e
     //  tamanho do buffer de 2048 bytes.
-	if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0)
-	{
-		SDL_Log("Failed to initialize SDL_mixer: %s", Mix_GetError());
-	}
+	if (!mIsDummy) {
+		if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0)
+		{
+			SDL_Log("Failed to initialize SDL_mixer: %s", Mix_GetError());
+		}
 
-    // TODO 2. : Utilize a função Mix_AllocateChannels para alocar o número de canais especificado.
-	Mix_AllocateChannels(numChannels);
+		// TODO 2. : Utilize a função Mix_AllocateChannels para alocar o número de canais especificado.
+		Mix_AllocateChannels(numChannels);
+	}
 
     // TODO 3.: Redimensione o vetor mChannels para o número de canais especificado.
 	mChannels.resize(numChannels);
@@ -47,7 +50,9 @@ AudioSystem::~AudioSystem()
 	mSounds.clear();
 
 	// Fecha o subsistema de áudio
-	Mix_CloseAudio();
+	if (!mIsDummy) {
+		Mix_CloseAudio();
+	}
 }
 
 // Updates the status of all the active sounds every frame
@@ -65,7 +70,7 @@ void AudioSystem::Update(float deltaTime)
 		// Verifica se o canal tem um handle válido
 		if (handle.IsValid()) {
 			// Verifica se o canal parou de tocar
-			if (Mix_Playing(channel) == 0) {
+			if (!IsChannelPlaying(channel)) {
 				// Remove do mapa de handles
 				mHandleMap.erase(handle);
 
@@ -93,7 +98,7 @@ SoundHandle AudioSystem::PlaySound(const std::string& soundName, bool looping)
 
     // TODO 1.: Verifique se o som foi carregado corretamente, ou seja, se o ponteiro sound é diferente de nullptr.
     //  Se for nullptr, registre um erro no log e retorne SoundHandle::Invalid.
-	if (!sound) {
+	if (!sound && !mIsDummy) {
 		SDL_Log("Erro: Som '%s' não carregado corretamente.", soundName.c_str());
 		return SoundHandle::Invalid;
 	}
@@ -175,7 +180,9 @@ SoundHandle AudioSystem::PlaySound(const std::string& soundName, bool looping)
     // TODO 8.: Use Mix_PlayChannel para tocar o som no canal disponível. Não se esqueça de passar -1
     //  para o parâmetro de loop se looping for true, ou 0 se não for.
 	int loopCount = looping ? -1 : 0;
-	Mix_PlayChannel(availableChannel, sound, loopCount);
+	if (!mIsDummy) {
+		Mix_PlayChannel(availableChannel, sound, loopCount);
+	}
 
     return mLastHandle;
 }
@@ -208,7 +215,9 @@ void AudioSystem::StopSound(SoundHandle sound)
 	int channel = it->second.mChannel;
 
 	// Para o som no canal associado
-	Mix_HaltChannel(channel);
+	if (!mIsDummy) {
+		Mix_HaltChannel(channel);
+	}
 
 	// Remove do mapa e reinicializa canal
 	mHandleMap.erase(it);
@@ -237,7 +246,9 @@ void AudioSystem::PauseSound(SoundHandle sound)
 	if (!it->second.mIsPaused)
 	{
 		// Pausa o som no canal associado
-		Mix_Pause(it->second.mChannel);
+		if (!mIsDummy) {
+			Mix_Pause(it->second.mChannel);
+		}
 
 		// Marca como pausado
 		it->second.mIsPaused = true;
@@ -266,7 +277,9 @@ void AudioSystem::ResumeSound(SoundHandle sound)
 	if (it->second.mIsPaused)
 	{
 		// Pausa o som no canal associado
-		Mix_Resume(it->second.mChannel);
+		if (!mIsDummy) {
+			Mix_Resume(it->second.mChannel);
+		}
 
 		// Marca como pausado
 		it->second.mIsPaused = false;
@@ -292,7 +305,9 @@ SoundState AudioSystem::GetSoundState(SoundHandle sound)
 // Stops all sounds on all channels
 void AudioSystem::StopAllSounds()
 {
-    Mix_HaltChannel(-1);
+    if (!mIsDummy) {
+        Mix_HaltChannel(-1);
+    }
 
     for(auto & mChannel : mChannels)
     {
@@ -302,6 +317,17 @@ void AudioSystem::StopAllSounds()
     mHandleMap.clear();
 }
 
+int AudioSystem::GetNumActiveChannels() const
+{
+	int numActive = 0;
+	for (const SoundHandle& handle : mChannels) {
+		if (handle.IsValid()) {
+			numActive++;
+		}
+	}
+	return numActive;
+}
+
 // Cache all sounds under Assets/Sounds
 void AudioSystem::CacheAllSounds()
 {
@@ -337,6 +363,11 @@ void AudioSystem::CacheSound(const std::string& soundName)
 //       "Assets/Sounds/ChompLoop.wav".
 Mix_Chunk* AudioSystem::GetSound(const std::string& soundName)
 {
+	// A saída falsa não carrega nenhum arquivo
+	if (mIsDummy) {
+		return nullptr;
+	}
+
 	std::string fileName = "../Assets/Sounds/";
 	fileName += soundName;
 
@@ -360,6 +391,17 @@ Mix_Chunk* AudioSystem::GetSound(const std::string& soundName)
 	return chunk;
 }
 
+// Whether the sound on the channel is still playing. The dummy sink keeps
+// looping sounds playing and finishes every other sound right away
+bool AudioSystem::IsChannelPlaying(int channel) const
+{
+	if (mIsDummy) {
+		auto it = mHandleMap.find(mChannels[channel]);
+		return it != mHandleMap.end() && it->second.mIsLooping;
+	}
+	return Mix_Playing(channel) != 0;
+}
+
 // Input for debugging purposes
 void AudioSystem::ProcessInput(const Uint8* keyState)
 {
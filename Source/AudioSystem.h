@@ -64,8 +64,9 @@ class AudioSystem
 {
 public:
     // Create the AudioSystem with specified number of channels
-    // (Defaults to 8 channels)
-    AudioSystem(int numChannels = 8);
+    // (Defaults to 8 channels). A dummy AudioSystem opens no audio device and
+    // loads no sounds, but still tracks handles and channels (used in headless runs)
+    AudioSystem(int numChannels = 8, bool isDummy = false);
     // Destroy the AudioSystem
     ~AudioSystem();
 
@@ -100,6 +101,10 @@ public:
 	// Stops all sounds on all channels
 	void StopAllSounds();
 
+	// Number of channels currently playing or paused
+	int GetNumActiveChannels() const;
+	int GetNumChannels() const { return static_cast<int>(mChannels.size()); }
+
 	// Cache all sounds under Assets/Sounds
 	void CacheAllSounds();
 
@@ -118,6 +123,8 @@ private:
 	//       "Assets/Sounds/ChompLoop.wav".
 	struct Mix_Chunk* GetSound(const std::string& soundName);
 
+	bool IsChannelPlaying(int channel) const;
+
 	// Internal struct used to track the properties of active sound handles
 	struct HandleInfo
 	{
@@ -144,4 +151,7 @@ private:
 
 	// Used for debug input in ProcessInput
 	bool mLastDebugKey = false;
+
+	// No audio device, see constructor
+	bool mIsDummy;
 };
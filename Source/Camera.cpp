@@ -7,6 +7,7 @@
 
 Camera::Camera(class Game* game, Vector2 startPosition)
     :mPos(startPosition)
+    ,mPreviousPos(startPosition)
     ,mGame(game)
     ,mCameraLerpSpeed(6.0f)
     ,mCameraMode(CameraMode::FollowPlayer)
@@ -23,6 +24,15 @@ Camera::Camera(class Game* game, Vector2 startPosition)
 {
 }
 
+Vector2 Camera::GetRenderPosCamera() const {
+    // Saltos grandes (troca de cena, respawn) não são interpolados
+    float maxStep = 4.0f * mGame->GetTileSize();
+    if ((mPos - mPreviousPos).LengthSq() > maxStep * maxStep) {
+        return mPos;
+    }
+    return Vector2::Lerp(mPreviousPos, mPos, mGame->GetRenderAlpha());
+}
+
 void Camera::StartCameraShake(float duration, float strength) {
     mIsShaking = true;
     mShakeTimer = 0.0f;
@@ -26,6 +26,9 @@ public:
 
     void SetPosition(Vector2 pos) { mPos = pos; }
     Vector2 GetPosCamera() const { return mPos; }
+    // Camera position interpolated between the last two simulation steps, used for drawing
+    void SavePreviousPosition() { mPreviousPos = mPos; }
+    Vector2 GetRenderPosCamera() const;
     void SetFixedCameraPosition(Vector2 pos) { mFixedCameraPosition = pos; }
 
     void Update(float deltaTime);
@@ -51,6 +54,7 @@ private:
     Vector2 PanoramicCamera(float deltaTime);
 
     Vector2 mPos;
+    Vector2 mPreviousPos;
     class Game *mGame;
     float mCameraLerpSpeed;
     CameraMode mCameraMode;
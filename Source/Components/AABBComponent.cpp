@@ -7,6 +7,8 @@
 #include "../Game.h"
 #include "../Math.h"
 #include "RigidBodyComponent.h"
+#include "../LevelSnapshot.h"
+#include <limits>
 
 
 AABBComponent::AABBComponent(class Actor* owner, Vector2 min, Vector2 max)
@@ -14,9 +16,49 @@ AABBComponent::AABBComponent(class Actor* owner, Vector2 min, Vector2 max)
     ,mMin(min)
     ,mMax(max)
     ,mIsActive(true)
+    ,mCollisionMode(CollisionMode::Discrete)
 {
 }
 
+Vector2 AABBComponent::GetLastDisplacement() const
+{
+    RigidBodyComponent* rigidBody = GetOwner()->GetComponent<RigidBodyComponent>();
+    if (rigidBody) {
+        return rigidBody->GetLastDisplacement();
+    }
+    return Vector2::Zero;
+}
+
+Vector2 AABBComponent::GetSweptMin() const
+{
+    Vector2 min = GetWorldMin();
+    if (mCollisionMode == CollisionMode::Swept) {
+        Vector2 start = min - GetLastDisplacement();
+        min = Vector2(Math::Min(min.x, start.x), Math::Min(min.y, start.y));
+    }
+    return min;
+}
+
+Vector2 AABBComponent::GetSweptMax() const
+{
+    Vector2 max = GetWorldMax();
+    if (mCollisionMode == CollisionMode::Swept) {
+        Vector2 start = max - GetLastDisplacement();
+        max = Vector2(Math::Max(max.x, start.x), Math::Max(max.y, start.y));
+    }
+    return max;
+}
+
+Vector2 AABBComponent::GetWorldMin() const
+{
+    return mMin + GetOwner()->GetPosition();
+}
+
+Vector2 AABBComponent::GetWorldMax() const
+{
+    return mMax + GetOwner()->GetPosition();
+}
+
 bool AABBComponent::Intersect(AABBComponent& b)
 {
     if (!mIsActive || !b.IsActive()) {
@@ -30,6 +72,90 @@ bool AABBComponent::Intersect(AABBComponent& b)
     return !notColliding;
 }
 
+bool AABBComponent::IntersectSwept(AABBComponent& b)
+{
+    if (Intersect(b)) {
+        return true;
+    }
+    if (mCollisionMode != CollisionMode::Swept || !mIsActive || !b.IsActive()) {
+        return false;
+    }
+
+    Vector2 displacement = GetLastDisplacement();
+    float toi;
+    Vector2 normal;
+    return SweepTest(b, GetOwner()->GetPosition() - displacement, displacement, toi, normal);
+}
+
+bool AABBComponent::SweepTest(AABBComponent& b, const Vector2& startPos, const Vector2& displacement,
+                              float& toi, Vector2& normal)
+{
+    Vector2 posB = b.GetOwner()->GetPosition();
+    return SweepBoxes(mMin + startPos, mMax + startPos, displacement, b.mMin + posB, b.mMax + posB, toi, normal);
+}
+
+bool AABBComponent::SweepBoxes(const Vector2& aMin, const Vector2& aMax, const Vector2& displacement,
+                               const Vector2& bMin, const Vector2& bMax, float& toi, Vector2& normal)
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    // Tempo de entrada e saída em cada eixo
+    float entryX, exitX, entryY, exitY;
+    if (displacement.x > 0.0f) {
+        entryX = (bMin.x - aMax.x) / displacement.x;
+        exitX = (bMax.x - aMin.x) / displacement.x;
+    }
+    else if (displacement.x < 0.0f) {
+        entryX = (bMax.x - aMin.x) / displacement.x;
+        exitX = (bMin.x - aMax.x) / displacement.x;
+    }
+    else {
+        if (aMax.x < bMin.x || aMin.x > bMax.x) {
+            return false;
+        }
+        entryX = -infinity;
+        exitX = infinity;
+    }
+
+    if (displacement.y > 0.0f) {
+        entryY = (bMin.y - aMax.y) / displacement.y;
+        exitY = (bMax.y - aMin.y) / displacement.y;
+    }
+    else if (displacement.y < 0.0f) {
+        entryY = (bMax.y - aMin.y) / displacement.y;
+        exitY = (bMin.y - aMax.y) / displacement.y;
+    }
+    else {
+        if (aMax.y < bMin.y || aMin.y > bMax.y) {
+            return false;
+        }
+        entryY = -infinity;
+        exitY = infinity;
+    }
+
+    float entry = Math::Max(entryX, entryY);
+    float exit = Math::Min(exitX, exitY);
+    if (entry > exit || entry > 1.0f || exit < 0.0f) {
+        return false;
+    }
+
+    if (entry < 0.0f) {
+        // Já começa sobreposto
+        toi = 0.0f;
+        normal = Vector2::Zero;
+        return true;
+    }
+
+    toi = entry;
+    if (entryX > entryY) {
+        normal = Vector2(displacement.x > 0.0f ? -1.0f : 1.0f, 0.0f);
+    }
+    else {
+        normal = Vector2(0.0f, displacement.y > 0.0f ? -1.0f : 1.0f);
+    }
+    return true;
+}
+
 std::array<bool, 4> AABBComponent::CollisionSide(AABBComponent& b) {
     Vector2 posA = GetOwner()->GetPosition();
     Vector2 posB = b.GetOwner()->GetPosition();
@@ -74,12 +200,17 @@ std::array<bool, 4> AABBComponent::CollisionSide(AABBComponent& b) {
 
 std::array<bool, 4> AABBComponent::ResolveCollision(AABBComponent& b)
 {
+    if (mCollisionMode == CollisionMode::Swept) {
+        return ResolveSweptCollision(b);
+    }
+
     Vector2 posA = GetOwner()->GetPosition();
     Vector2 posB = b.GetOwner()->GetPosition();
     Vector2 vel = Vector2::Zero;
 
-    if (GetOwner()->GetComponent<RigidBodyComponent>() != nullptr) {
-        vel = GetOwner()->GetComponent<RigidBodyComponent>()->GetVelocity();
+    RigidBodyComponent* rigidBody = GetOwner()->GetComponent<RigidBodyComponent>();
+    if (rigidBody != nullptr) {
+        vel = rigidBody->GetVelocity();
     }
 
     // Detecta se colidiu {top, bottom, left, right}
@@ -141,7 +272,7 @@ std::array<bool, 4> AABBComponent::ResolveCollision(AABBComponent& b)
 
         if (vel.y >= 0) {
             // GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, vel.y));
-            GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, 0));
+            rigidBody->SetVelocity(Vector2(vel.x, 0));
             GetOwner()->SetPosition(posA + min);
             return collision;
         }
@@ -193,20 +324,20 @@ std::array<bool, 4> AABBComponent::ResolveCollision(AABBComponent& b)
         }
 
         if (Math::Abs(left - top) < dist && vel.y > 0 && vel.x == 0) {
-            GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, 0));
+            rigidBody->SetVelocity(Vector2(vel.x, 0));
             GetOwner()->SetPosition(posA + dTop);
             collision = {true, false, false, false};
             return collision;
         }
 
         if (Math::Abs(left - top) < dist && vel.y > 0) {
-            GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, 0));
+            rigidBody->SetVelocity(Vector2(vel.x, 0));
             GetOwner()->SetPosition(posA + dTop);
             collision = {true, false, false, false};
             return collision;
         }
 
-        GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(0, vel.y));
+        rigidBody->SetVelocity(Vector2(0, vel.y));
         GetOwner()->SetPosition(posA + min);
         return collision;
     }
@@ -224,22 +355,103 @@ std::array<bool, 4> AABBComponent::ResolveCollision(AABBComponent& b)
         }
 
         if (Math::Abs(right - top) < dist && vel.y > 0 && vel.x == 0) {
-            GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, 0));
+            rigidBody->SetVelocity(Vector2(vel.x, 0));
             GetOwner()->SetPosition(posA + dTop);
             collision = {true, false, false, false};
             return collision;
         }
 
         if (Math::Abs(right - top) < dist && vel.y > 0) {
-            GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(vel.x, 0));
+            rigidBody->SetVelocity(Vector2(vel.x, 0));
             GetOwner()->SetPosition(posA + dTop);
             collision = {true, false, false, false};
             return collision;
         }
 
-        GetOwner()->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2(0, vel.y));
+        rigidBody->SetVelocity(Vector2(0, vel.y));
         GetOwner()->SetPosition(posA + min);
         return collision;
     }
     return collision;
 }
+
+std::array<bool, 4> AABBComponent::ResolveSweptCollision(AABBComponent& b)
+{
+    Vector2 posA = GetOwner()->GetPosition();
+    Vector2 posB = b.GetOwner()->GetPosition();
+    Vector2 bMin = b.mMin + posB;
+    Vector2 bMax = b.mMax + posB;
+
+    RigidBodyComponent* rigidBody = GetOwner()->GetComponent<RigidBodyComponent>();
+    Vector2 vel = rigidBody ? rigidBody->GetVelocity() : Vector2::Zero;
+    Vector2 displacement = rigidBody ? rigidBody->GetLastDisplacement() : Vector2::Zero;
+
+    // Detecta se colidiu {top, bottom, left, right}
+    std::array<bool, 4> collision = {false, false, false, false};
+
+    // O lado da colisão vem da face que foi atingida primeiro no movimento do frame
+    float toi;
+    Vector2 normal;
+    if (!SweepTest(b, posA - displacement, displacement, toi, normal) || normal == Vector2::Zero) {
+        // Já estava sobreposto no início do frame: usa a menor penetração
+        collision = CollisionSide(b);
+    }
+    else if (normal.y < 0.0f) {
+        collision[0] = true;
+    }
+    else if (normal.y > 0.0f) {
+        collision[1] = true;
+    }
+    else if (normal.x < 0.0f) {
+        collision[2] = true;
+    }
+    else {
+        collision[3] = true;
+    }
+
+    // Encosta na face atingida, mantendo o movimento no outro eixo
+    if (collision[0]) {
+        posA.y = bMin.y - mMax.y;
+        if (vel.y > 0) {
+            vel.y = 0;
+        }
+    }
+    else if (collision[1]) {
+        posA.y = bMax.y - mMin.y;
+        if (vel.y < 0) {
+            vel.y = 0;
+        }
+    }
+    else if (collision[2]) {
+        posA.x = bMin.x - mMax.x;
+        if (vel.x > 0) {
+            vel.x = 0;
+        }
+    }
+    else if (collision[3]) {
+        posA.x = bMax.x - mMin.x;
+        if (vel.x < 0) {
+            vel.x = 0;
+        }
+    }
+
+    GetOwner()->SetPosition(posA);
+    if (rigidBody) {
+        rigidBody->SetVelocity(vel);
+    }
+    return collision;
+}
+
+void AABBComponent::SaveState(LevelSnapshot& snapshot) const
+{
+    snapshot.Write(mMin);
+    snapshot.Write(mMax);
+    snapshot.Write(mIsActive);
+}
+
+void AABBComponent::LoadState(LevelSnapshot& snapshot)
+{
+    snapshot.Read(mMin);
+    snapshot.Read(mMax);
+    snapshot.Read(mIsActive);
+}
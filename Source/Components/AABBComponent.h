@@ -8,6 +8,14 @@
 #include "../Math.h"
 #include <array>
 
+enum class CollisionMode
+{
+    // Overlap test at the end of the frame, with a corner tolerance that depends on FPS
+    Discrete,
+    // Uses the owner's last displacement to find the time of impact, so fast movers don't tunnel
+    Swept
+};
+
 class AABBComponent : public Component
 {
 public:
@@ -18,15 +26,47 @@ public:
     Vector2 GetMin() { return mMin; }
     Vector2 GetMax() { return mMax; }
 
+    // Bounds in world space (offset by the owner's position)
+    Vector2 GetWorldMin() const;
+    Vector2 GetWorldMax() const;
+
     void SetActive(bool active) { mIsActive = active; }
     bool IsActive() const { return mIsActive; }
 
+    void SetCollisionMode(CollisionMode mode) { mCollisionMode = mode; }
+    CollisionMode GetCollisionMode() const { return mCollisionMode; }
+
+    // How much the owner moved in the last frame (zero without a RigidBodyComponent)
+    Vector2 GetLastDisplacement() const;
+
+    // Box covering where the owner was at the start of the frame and where it is now
+    Vector2 GetSweptMin() const;
+    Vector2 GetSweptMax() const;
+
     bool Intersect(AABBComponent& b);
+    // Same as Intersect, but in Swept mode also detects b when the owner passed through it this frame
+    bool IntersectSwept(AABBComponent& b);
     std::array<bool, 4> ResolveCollision(AABBComponent& b);
     std::array<bool, 4> CollisionSide(AABBComponent& b);
 
+    // Time of impact of this box moving by displacement from startPos against b.
+    // toi is the fraction of displacement in [0, 1] and normal the face of b that was hit
+    // (zero if the boxes already overlap at startPos). Returns false if they never touch
+    bool SweepTest(AABBComponent& b, const Vector2& startPos, const Vector2& displacement,
+                   float& toi, Vector2& normal);
+
+    // Same test for boxes given in world space
+    static bool SweepBoxes(const Vector2& aMin, const Vector2& aMax, const Vector2& displacement,
+                           const Vector2& bMin, const Vector2& bMax, float& toi, Vector2& normal);
+
+    void SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
+    std::array<bool, 4> ResolveSweptCollision(AABBComponent& b);
+
     Vector2 mMin;
     Vector2 mMax;
     bool mIsActive;
+    CollisionMode mCollisionMode;
 };
@@ -15,4 +15,8 @@ void Component::Update(float deltaTime) {}
 
 void Component::ProcessInput(const Uint8* keyState) {}
 
+void Component::SaveState(class LevelSnapshot& snapshot) const {}
+
+void Component::LoadState(class LevelSnapshot& snapshot) {}
+
 class Game* Component::GetGame() const { return mOwner->GetGame(); }
@@ -15,6 +15,10 @@ public:
     // Process input for this component (if needed)
     virtual void ProcessInput(const Uint8* keyState);
 
+    // State saved and restored along with the owner's (see Actor::SaveState); none by default
+    virtual void SaveState(class LevelSnapshot& snapshot) const;
+    virtual void LoadState(class LevelSnapshot& snapshot);
+
     int GetUpdateOrder() const { return mUpdateOrder; }
     class Actor* GetOwner() const { return mOwner; }
     class Game* GetGame() const;
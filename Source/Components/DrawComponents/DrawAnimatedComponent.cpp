@@ -5,49 +5,27 @@
 #include "DrawAnimatedComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
-#include "../../Json.h"
-#include <fstream>
+#include "../../SpriteSheetAsset.h"
+#include "../../SpriteBatch.h"
+#include "../../LevelSnapshot.h"
 
 DrawAnimatedComponent::DrawAnimatedComponent(Actor* owner, float width, float height,
                                              const std::string &spriteSheetPath, const std::string &spriteSheetData,
                                              int drawOrder)
     :DrawSpriteComponent(owner, spriteSheetPath, width, height, drawOrder)
+    ,mSpriteSheet(nullptr)
     ,mTransparency(255)
     ,mUseFlip(false)
     ,mFlip(SDL_FLIP_NONE)
     ,mUseRotation(false)
     ,mOffsetRotation(0.0f)
 {
-    LoadSpriteSheet(spriteSheetPath, spriteSheetData);
+    // The sprite sheet texture is already acquired by DrawSpriteComponent
+    mSpriteSheet = GetGame()->LoadSpriteSheet(spriteSheetData);
 }
 
 DrawAnimatedComponent::~DrawAnimatedComponent()
 {
-    for (const auto &rect: mSpriteSheetData) {
-        delete rect;
-    }
-    mSpriteSheetData.clear();
-}
-
-void DrawAnimatedComponent::LoadSpriteSheet(const std::string &texturePath, const std::string &dataPath)
-{
-    // Load sprite sheet texture
-    mSpriteSheetSurface = mOwner->GetGame()->LoadTexture(texturePath);
-
-    // Load sprite sheet data
-    std::ifstream spriteSheetFile(dataPath);
-    nlohmann::json spriteSheetData = nlohmann::json::parse(spriteSheetFile);
-
-    SDL_Rect* rect = nullptr;
-    for (const auto &frame: spriteSheetData["frames"]) {
-        int x = frame["frame"]["x"].get<int>();
-        int y = frame["frame"]["y"].get<int>();
-        int w = frame["frame"]["w"].get<int>();
-        int h = frame["frame"]["h"].get<int>();
-        rect = new SDL_Rect({x, y, w, h});
-
-        mSpriteSheetData.emplace_back(rect);
-    }
 }
 
 void DrawAnimatedComponent::Draw(SDL_Renderer* renderer)
@@ -56,16 +34,27 @@ void DrawAnimatedComponent::Draw(SDL_Renderer* renderer)
         return;
     }
 
-    int spriteIdx = mAnimations[mAnimName][static_cast<int>(mAnimTimer)];
+    if (mCurrentClip < 0) {
+        return;
+    }
+
+    const SpriteSheetAsset::AnimationClip& clip = mSpriteSheet->GetClip(mCurrentClip);
+    if (clip.mFrames.empty()) {
+        return;
+    }
 
-    SDL_Rect* srcRect = mSpriteSheetData[spriteIdx];
+    // Quadros são relativos ao sprite sheet, que pode estar dentro de um atlas
+    SDL_Rect srcRect = clip.mFrames[static_cast<int>(mAnimTimer)];
+    srcRect.x += mTextureRegion.x;
+    srcRect.y += mTextureRegion.y;
 
     // Calcula a posição na tela
     SDL_Rect dstRect;
     dstRect.h = mHeight;
     dstRect.w = mWidth;
-    dstRect.x = mOwner->GetPosition().x - mWidth / 2 - GetGame()->GetCamera()->GetPosCamera().x;
-    dstRect.y = mOwner->GetPosition().y - mHeight / 2 - GetGame()->GetCamera()->GetPosCamera().y;
+    Vector2 screenPos = mOwner->GetRenderPosition() - GetGame()->GetCamera()->GetRenderPosCamera();
+    dstRect.x = screenPos.x - mWidth / 2;
+    dstRect.y = screenPos.y - mHeight / 2;
 
     if (!mUseFlip) {
         mFlip = SDL_FLIP_NONE;
@@ -92,9 +81,18 @@ void DrawAnimatedComponent::Draw(SDL_Renderer* renderer)
     //     mFlip = flip;
     // }
 
-    SDL_SetTextureBlendMode(mSpriteSheetSurface, SDL_BLENDMODE_BLEND);
-    SDL_SetTextureAlphaMod(mSpriteSheetSurface, mTransparency);
-    SDL_RenderCopyEx(renderer, mSpriteSheetSurface, srcRect, &dstRect, angle, nullptr, mFlip);
+    // Transparência vai na cor dos vértices
+    SDL_Color color = {255, 255, 255, static_cast<Uint8>(mTransparency)};
+    GetGame()->GetSpriteBatch()->Draw(mSpriteSheetSurface, &srcRect, dstRect, angle, mFlip, color);
+}
+
+bool DrawAnimatedComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    if (mUseRotation) {
+        ComputeScreenBounds(true, bounds);
+        return true;
+    }
+    return DrawSpriteComponent::GetScreenBounds(bounds);
 }
 
 void DrawAnimatedComponent::Update(float deltaTime) {
@@ -102,21 +100,73 @@ void DrawAnimatedComponent::Update(float deltaTime) {
         return;
     }
 
+    if (mCurrentClip < 0) {
+        return;
+    }
+
     mAnimTimer += deltaTime * mAnimFPS;
 
-    int numFrames = mAnimations[mAnimName].size();
+    int numFrames = mSpriteSheet->GetClip(mCurrentClip).mFrames.size();
+    if (numFrames == 0) {
+        mAnimTimer = 0.0f;
+        return;
+    }
     while (mAnimTimer >= numFrames) {
         mAnimTimer -= numFrames;
     }
 }
 
-void DrawAnimatedComponent::SetAnimation(const std::string &name)
+void DrawAnimatedComponent::SetAnimation(int clip)
 {
-    mAnimName = name;
+    if (clip == mCurrentClip) {
+        return;
+    }
+
+    mCurrentClip = clip;
     Update(0);
 }
 
-void DrawAnimatedComponent::AddAnimation(const std::string &name, const std::vector<int> &spriteNums)
+void DrawAnimatedComponent::SetAnimation(const std::string &name)
+{
+    auto iter = mAnimations.find(name);
+    if (iter == mAnimations.end()) {
+        SDL_Log("Animação %s não encontrada", name.c_str());
+        return;
+    }
+    SetAnimation(iter->second);
+}
+
+int DrawAnimatedComponent::AddAnimation(const std::string &name, const std::vector<int> &spriteNums)
+{
+    if (!mSpriteSheet) {
+        return -1;
+    }
+
+    int clipIndex = mSpriteSheet->RegisterClip(name, spriteNums);
+    if (clipIndex >= 0) {
+        mAnimations[name] = clipIndex;
+    }
+    return clipIndex;
+}
+
+void DrawAnimatedComponent::SaveState(LevelSnapshot& snapshot) const
+{
+    DrawComponent::SaveState(snapshot);
+    snapshot.Write(mCurrentClip);
+    snapshot.Write(mAnimTimer);
+    snapshot.Write(mAnimFPS);
+    snapshot.Write(mIsPaused);
+    snapshot.Write(mFlip);
+    snapshot.Write(mTransparency);
+}
+
+void DrawAnimatedComponent::LoadState(LevelSnapshot& snapshot)
 {
-    mAnimations.emplace(name, spriteNums);
+    DrawComponent::LoadState(snapshot);
+    snapshot.Read(mCurrentClip);
+    snapshot.Read(mAnimTimer);
+    snapshot.Read(mAnimFPS);
+    snapshot.Read(mIsPaused);
+    snapshot.Read(mFlip);
+    snapshot.Read(mTransparency);
 }
@@ -16,6 +16,7 @@ public:
     ~DrawAnimatedComponent() override;
 
     void Draw(SDL_Renderer* renderer) override;
+    bool GetScreenBounds(SDL_Rect& bounds) const override;
     void Update(float deltaTime) override;
 
     void UseFlip(bool useFlip) { mUseFlip = useFlip; }
@@ -26,29 +27,33 @@ public:
     // Use to change the FPS of the animation
     void SetAnimFPS(float fps) { mAnimFPS = fps; }
 
-    // Set the current active animation
+    // Set the current active animation. Does nothing if the clip is already active
+    void SetAnimation(int clip);
+    // Convenience for setup code; resolves the name to a clip with a map lookup
     void SetAnimation(const std::string &name);
     void ResetAnimationTimer() { mAnimTimer = 0; }
 
     // Use to pause/unpause the animation
     void SetIsPaused(bool pause) { mIsPaused = pause; }
 
-    // Add an animation of the corresponding name to the animation map
-    void AddAnimation(const std::string &name, const std::vector<int> &images);
+    // Add an animation of the corresponding name to the animation map.
+    // Returns the clip handle to pass to SetAnimation, or -1 if the frames are invalid
+    int AddAnimation(const std::string &name, const std::vector<int> &images);
 
     void SetTransparency(int transparency) { mTransparency = transparency; }
 
-private:
-    void LoadSpriteSheet(const std::string &texturePath, const std::string &dataPath);
+    void SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
 
-    // Vector of sprites
-    std::vector<SDL_Rect* > mSpriteSheetData;
+private:
+    // Frame data shared by every component using the same sprite sheet (owned by Game)
+    class SpriteSheetAsset* mSpriteSheet;
 
-    // Map of animation name to vector of textures corresponding to the animation
-    std::unordered_map<std::string, std::vector<int> > mAnimations;
+    // Map of animation name to the index of its clip in mSpriteSheet
+    std::unordered_map<std::string, int> mAnimations;
 
-    // Name of current animation
-    std::string mAnimName;
+    // Clip of the current animation (-1 if none was set)
+    int mCurrentClip = -1;
 
     // Tracks current elapsed time in animation
     float mAnimTimer = 0.0f;
@@ -5,11 +5,13 @@
 #include "DrawComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
+#include "../../LevelSnapshot.h"
 
 DrawComponent::DrawComponent(class Actor* owner, int drawOrder)
     :Component(owner)
     ,mIsVisible(true)
     ,mDrawOrder(drawOrder)
+    ,mDrawListIndex(-1)
 {
     mOwner->GetGame()->AddDrawable(this);
 }
@@ -18,3 +20,18 @@ DrawComponent::~DrawComponent() { mOwner->GetGame()->RemoveDrawable(this); }
 
 
 void DrawComponent::Draw(SDL_Renderer* renderer) {}
+
+bool DrawComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    return false;
+}
+
+void DrawComponent::SaveState(LevelSnapshot& snapshot) const
+{
+    snapshot.Write(mIsVisible);
+}
+
+void DrawComponent::LoadState(LevelSnapshot& snapshot)
+{
+    snapshot.Read(mIsVisible);
+}
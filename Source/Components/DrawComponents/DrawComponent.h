@@ -18,12 +18,24 @@ public:
 
     virtual void Draw(SDL_Renderer* renderer);
 
+    // Screen-space rectangle this drawable covers in the current frame, used to cull
+    // drawables outside the view. Returns false if the bounds are unknown (never culled)
+    virtual bool GetScreenBounds(SDL_Rect& bounds) const;
+
     bool IsVisible() const { return mIsVisible; }
     void SetIsVisible(const bool isVisible) { mIsVisible = isVisible; }
 
     int GetDrawOrder() const { return mDrawOrder; }
 
+    void SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
+    // Position in the game's DrawList bucket, maintained by the DrawList
+    void SetDrawListIndex(int index) { mDrawListIndex = index; }
+    int GetDrawListIndex() const { return mDrawListIndex; }
+
 protected:
     bool mIsVisible;
     int mDrawOrder;
+    int mDrawListIndex;
 };
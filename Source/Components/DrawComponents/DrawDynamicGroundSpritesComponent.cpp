@@ -6,6 +6,7 @@
 #include "../AABBComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
+#include "../../SpriteBatch.h"
 #include "../../Actors/DynamicGround.h"
 
 DrawDynamicGroundSpritesComponent::DrawDynamicGroundSpritesComponent(Actor* owner, int width, int height, const int drawOrder)
@@ -14,6 +15,23 @@ DrawDynamicGroundSpritesComponent::DrawDynamicGroundSpritesComponent(Actor* owne
     mOwnerDynamicGround = dynamic_cast<DynamicGround*>(mOwner);
 }
 
+bool DrawDynamicGroundSpritesComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    AABBComponent* aabb = mOwner->GetComponent<AABBComponent>();
+    if (!aabb) {
+        return false;
+    }
+
+    Vector2 offset = mOwner->GetRenderPosition() - mOwner->GetGame()->GetCamera()->GetRenderPosCamera();
+    Vector2 min = aabb->GetMin() + offset;
+    Vector2 max = aabb->GetMax() + offset;
+    bounds.x = static_cast<int>(min.x);
+    bounds.y = static_cast<int>(min.y);
+    bounds.w = static_cast<int>(max.x - min.x) + 1;
+    bounds.h = static_cast<int>(max.y - min.y) + 1;
+    return true;
+}
+
 void DrawDynamicGroundSpritesComponent::Draw(SDL_Renderer* renderer)
 {
     if (!mIsVisible) {
@@ -21,13 +39,21 @@ void DrawDynamicGroundSpritesComponent::Draw(SDL_Renderer* renderer)
     }
 
     SDL_Texture* texture = mOwner->GetGame()->GetTileSheet();
-    std::unordered_map<int, SDL_Rect> tileSheetData = mOwner->GetGame()->GetTileSheetData();
+    SpriteBatch* spriteBatch = GetGame()->GetSpriteBatch();
+    const std::unordered_map<int, SDL_Rect>& tileSheetData = mOwner->GetGame()->GetTileSheetData();
+
+    Vector2 cameraPos = GetGame()->GetCamera()->GetRenderPosCamera();
+    Vector2 ownerPos = mOwner->GetRenderPosition();
 
     for (const auto &pair: mSpriteOffsetMap) {
         int tileIndex = pair.first;
         const std::vector<Vector2> &offsets = pair.second;
 
-        SDL_Rect srcRect = tileSheetData[tileIndex];
+        auto iter = tileSheetData.find(tileIndex);
+        if (iter == tileSheetData.end()) {
+            continue;
+        }
+        SDL_Rect srcRect = iter->second;
 
         for (const Vector2 &offset: offsets)
         {
@@ -39,10 +65,10 @@ void DrawDynamicGroundSpritesComponent::Draw(SDL_Renderer* renderer)
             if (ownerWidth != 0 && ownerHeight != 0) {
                 SDL_Rect region;
                 // offset pos
-                Vector2 offsetPos = offset + mOwnerDynamicGround->GetStartingPosition() - GetGame()->GetCamera()->GetPosCamera();
+                Vector2 offsetPos = offset + mOwnerDynamicGround->GetStartingPosition() - cameraPos;
 
-                Vector2 ownerMinOffsetPos = mOwner->GetComponent<AABBComponent>()->GetMin() + mOwner->GetPosition() - GetGame()->GetCamera()->GetPosCamera();
-                Vector2 ownerMaxOffsetPos = mOwner->GetComponent<AABBComponent>()->GetMax() + mOwner->GetPosition() - GetGame()->GetCamera()->GetPosCamera();
+                Vector2 ownerMinOffsetPos = mOwner->GetComponent<AABBComponent>()->GetMin() + ownerPos - cameraPos;
+                Vector2 ownerMaxOffsetPos = mOwner->GetComponent<AABBComponent>()->GetMax() + ownerPos - cameraPos;
 
                 // Horizontal
                 if (offsetPos.x >= ownerMinOffsetPos.x && offsetPos.x + mWidth <= ownerMaxOffsetPos.x) {
@@ -78,11 +104,16 @@ void DrawDynamicGroundSpritesComponent::Draw(SDL_Renderer* renderer)
                     srcRect.h = ownerMaxOffsetPos.y - offsetPos.y + 1;;
                 }
 
+                // Só desenha os tiles que aparecem na tela
+                if (!IsTileVisible(region)) {
+                    continue;
+                }
+
                 SDL_RendererFlip flip = SDL_FLIP_NONE;
                 if (GetOwner()->GetRotation() == Math::Pi)
                     flip = SDL_FLIP_HORIZONTAL;
 
-                SDL_RenderCopyEx(renderer, texture, &srcRect, &region, 0.0f, nullptr, flip);
+                spriteBatch->Draw(texture, &srcRect, region, 0.0f, flip);
             }
         }
     }
@@ -14,6 +14,8 @@ public:
     DrawDynamicGroundSpritesComponent(Actor* owner, int width = 0, int height = 0, int drawOrder = 101);
 
     void Draw(SDL_Renderer* renderer) override;
+    // Tiles are clipped to the owner AABB, so it bounds everything drawn
+    bool GetScreenBounds(SDL_Rect& bounds) const override;
 
 protected:
     class DynamicGround* mOwnerDynamicGround;
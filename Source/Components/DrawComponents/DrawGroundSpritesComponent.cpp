@@ -5,42 +5,105 @@
 #include "DrawGroundSpritesComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
+#include "../../SpriteBatch.h"
 
 DrawGroundSpritesComponent::DrawGroundSpritesComponent(Actor* owner, int width, int height, const int drawOrder)
     :DrawComponent(owner, drawOrder)
+    ,mLocalMin(Vector2::Zero)
+    ,mLocalMax(Vector2::Zero)
     ,mWidth(width)
     ,mHeight(height)
+    ,mIsBaked(false)
 {
 }
 
+void DrawGroundSpritesComponent::SetSpriteOffsetMap(std::unordered_map<int, std::vector<Vector2> > spriteOffsetMap)
+{
+    mSpriteOffsetMap = spriteOffsetMap;
+    UpdateLocalBounds();
+}
+
+void DrawGroundSpritesComponent::UpdateLocalBounds()
+{
+    bool first = true;
+    for (const auto& pair: mSpriteOffsetMap) {
+        for (const Vector2& offset: pair.second) {
+            if (first) {
+                mLocalMin = offset;
+                mLocalMax = offset;
+                first = false;
+                continue;
+            }
+            mLocalMin.x = Math::Min(mLocalMin.x, offset.x);
+            mLocalMin.y = Math::Min(mLocalMin.y, offset.y);
+            mLocalMax.x = Math::Max(mLocalMax.x, offset.x);
+            mLocalMax.y = Math::Max(mLocalMax.y, offset.y);
+        }
+    }
+
+    if (first) {
+        mLocalMin = Vector2::Zero;
+        mLocalMax = Vector2::Zero;
+    }
+}
+
+bool DrawGroundSpritesComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    Vector2 screenPos = mOwner->GetRenderPosition() - mOwner->GetGame()->GetCamera()->GetRenderPosCamera();
+    bounds.x = static_cast<int>(screenPos.x + mLocalMin.x);
+    bounds.y = static_cast<int>(screenPos.y + mLocalMin.y);
+    bounds.w = static_cast<int>(mLocalMax.x - mLocalMin.x) + mWidth + 1;
+    bounds.h = static_cast<int>(mLocalMax.y - mLocalMin.y) + mHeight + 1;
+    return true;
+}
+
+bool DrawGroundSpritesComponent::IsTileVisible(const SDL_Rect& region) const
+{
+    Game* game = mOwner->GetGame();
+    return region.x + region.w > 0 && region.x < game->GetLogicalWindowWidth() &&
+           region.y + region.h > 0 && region.y < game->GetLogicalWindowHeight();
+}
+
 void DrawGroundSpritesComponent::Draw(SDL_Renderer* renderer)
 {
-    if (!mIsVisible) {
+    if (!mIsVisible || mIsBaked) {
         return;
     }
 
     SDL_Texture* texture = mOwner->GetGame()->GetTileSheet();
-    std::unordered_map<int, SDL_Rect> tileSheetData = mOwner->GetGame()->GetTileSheetData();
+    SpriteBatch* spriteBatch = GetGame()->GetSpriteBatch();
+    const std::unordered_map<int, SDL_Rect>& tileSheetData = mOwner->GetGame()->GetTileSheetData();
+
+    Vector2 screenPos = mOwner->GetRenderPosition() - GetGame()->GetCamera()->GetRenderPosCamera();
 
     for (const auto& pair: mSpriteOffsetMap) {
         int tileIndex = pair.first;
         const std::vector<Vector2>& offsets = pair.second;
 
-        SDL_Rect srcRect = tileSheetData[tileIndex];
+        auto iter = tileSheetData.find(tileIndex);
+        if (iter == tileSheetData.end()) {
+            continue;
+        }
+        const SDL_Rect& srcRect = iter->second;
 
         for (const Vector2& offset: offsets) {
             SDL_Rect region;
             region.h = mHeight;
             region.w = mWidth;
-            region.x = mOwner->GetPosition().x - GetGame()->GetCamera()->GetPosCamera().x + offset.x;
-            region.y = mOwner->GetPosition().y - GetGame()->GetCamera()->GetPosCamera().y + offset.y;
+            region.x = screenPos.x + offset.x;
+            region.y = screenPos.y + offset.y;
+
+            // Só desenha os tiles que aparecem na tela
+            if (!IsTileVisible(region)) {
+                continue;
+            }
 
             SDL_RendererFlip flip = SDL_FLIP_NONE;
             if (GetOwner()->GetRotation() == Math::Pi) {
                 flip = SDL_FLIP_HORIZONTAL;
             }
 
-            SDL_RenderCopyEx(renderer, texture, &srcRect, &region, 0.0f, nullptr, flip);
+            spriteBatch->Draw(texture, &srcRect, region, 0.0f, flip);
         }
     }
 }
@@ -14,13 +14,28 @@ public:
     DrawGroundSpritesComponent(Actor* owner, int width = 32, int height = 32, int drawOrder = 100);
 
     void Draw(SDL_Renderer* renderer) override;
-    void SetSpriteOffsetMap(std::unordered_map<int, std::vector<Vector2> > spriteOffsetMap) {mSpriteOffsetMap = spriteOffsetMap; }
-    void SetWidth(float width) { mWidth = width; }
-    void SetHeight(float height) { mHeight = height; }
+    bool GetScreenBounds(SDL_Rect& bounds) const override;
+    void SetSpriteOffsetMap(std::unordered_map<int, std::vector<Vector2> > spriteOffsetMap);
+    const std::unordered_map<int, std::vector<Vector2> >& GetSpriteOffsetMap() const { return mSpriteOffsetMap; }
+    void SetWidth(float width) { mWidth = width; UpdateLocalBounds(); }
+    void SetHeight(float height) { mHeight = height; UpdateLocalBounds(); }
+
+    // Baked tiles are drawn by the game's TileChunkLayer instead of this component
+    void SetIsBaked(bool isBaked) { mIsBaked = isBaked; }
+    bool GetIsBaked() const { return mIsBaked; }
 
 protected:
+    // Whether a tile drawn at region is inside the logical window
+    bool IsTileVisible(const SDL_Rect& region) const;
+
     std::unordered_map<int, std::vector<Vector2> > mSpriteOffsetMap;
 
+    // Bounds of all tiles relative to the owner, updated when the offsets or the tile size change
+    void UpdateLocalBounds();
+    Vector2 mLocalMin;
+    Vector2 mLocalMax;
+
     int mWidth;
     int mHeight;
+    bool mIsBaked;
 };
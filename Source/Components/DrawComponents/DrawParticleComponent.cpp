@@ -5,6 +5,7 @@
 #include "DrawParticleComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
+#include "../../SpriteBatch.h"
 
 DrawParticleComponent::DrawParticleComponent(class Actor* owner, const std::string& texturePath, const int width,
                                          const int height, SDL_Color color, int drawOrder)
@@ -22,8 +23,9 @@ void DrawParticleComponent::Draw(SDL_Renderer* renderer)
     SDL_Rect dstRect;
     dstRect.h = mHeight;
     dstRect.w = mWidth;
-    dstRect.x = mOwner->GetPosition().x - mWidth / 2 - GetGame()->GetCamera()->GetPosCamera().x;
-    dstRect.y = mOwner->GetPosition().y - mHeight / 2 - GetGame()->GetCamera()->GetPosCamera().y;
+    Vector2 screenPos = mOwner->GetRenderPosition() - GetGame()->GetCamera()->GetRenderPosCamera();
+    dstRect.x = screenPos.x - mWidth / 2;
+    dstRect.y = screenPos.y - mHeight / 2;
 
     SDL_RendererFlip flip = SDL_FLIP_NONE;
     if (GetOwner()->GetRotation() == Math::Pi) {
@@ -33,11 +35,6 @@ void DrawParticleComponent::Draw(SDL_Renderer* renderer)
     float angle = 0;
     angle = Math::ToDegrees(GetOwner()->GetRotation());
 
-    SDL_SetTextureColorMod(mSpriteSheetSurface, mColor.r,mColor.g, mColor.b);
-
-    // Define blend mode e transparência
-    SDL_SetTextureBlendMode(mSpriteSheetSurface, SDL_BLENDMODE_BLEND);
-    SDL_SetTextureAlphaMod(mSpriteSheetSurface, mColor.a);
-
-    SDL_RenderCopyEx(renderer, mSpriteSheetSurface, nullptr, &dstRect, angle, nullptr, flip);
+    // Cor e transparência vão na cor dos vértices
+    GetGame()->GetSpriteBatch()->Draw(mSpriteSheetSurface, &mTextureRegion, dstRect, angle, flip, mColor);
 }
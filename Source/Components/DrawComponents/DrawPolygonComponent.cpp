@@ -20,10 +20,13 @@ void DrawPolygonComponent::Draw(SDL_Renderer* renderer)
         return;
     }
 
+    // Desenha direto no renderer, então os sprites pendentes vão antes
+    mOwner->GetGame()->FlushSpriteBatch();
+
     SDL_SetRenderDrawColor(renderer, mColor.r, mColor.g, mColor.b, mColor.a);
 
-    Vector2 pos = mOwner->GetPosition();
-    Vector2 cameraPos = mOwner->GetGame()->GetCamera()->GetPosCamera();
+    Vector2 pos = mOwner->GetRenderPosition();
+    Vector2 cameraPos = mOwner->GetGame()->GetCamera()->GetRenderPosCamera();
 
     // Render vertices as lines
     for (int i = 0; i < mVertices.size() - 1; i++) {
@@ -36,4 +39,28 @@ void DrawPolygonComponent::Draw(SDL_Renderer* renderer)
                        pos.y + mVertices[mVertices.size() - 1].y - cameraPos.y,
                        pos.x + mVertices[0].x - cameraPos.x,
                        pos.y + mVertices[0].y - cameraPos.y);
+    mOwner->GetGame()->CountDrawCalls(static_cast<int>(mVertices.size()));
+}
+
+bool DrawPolygonComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    if (mVertices.empty()) {
+        return false;
+    }
+
+    Vector2 min = mVertices[0];
+    Vector2 max = mVertices[0];
+    for (const Vector2& vertex : mVertices) {
+        min.x = Math::Min(min.x, vertex.x);
+        min.y = Math::Min(min.y, vertex.y);
+        max.x = Math::Max(max.x, vertex.x);
+        max.y = Math::Max(max.y, vertex.y);
+    }
+
+    Vector2 screenPos = mOwner->GetRenderPosition() - mOwner->GetGame()->GetCamera()->GetRenderPosCamera();
+    bounds.x = static_cast<int>(screenPos.x + min.x);
+    bounds.y = static_cast<int>(screenPos.y + min.y);
+    bounds.w = static_cast<int>(max.x - min.x) + 1;
+    bounds.h = static_cast<int>(max.y - min.y) + 1;
+    return true;
 }
@@ -14,6 +14,7 @@ public:
                          int drawOrder = 100);
 
     void Draw(SDL_Renderer* renderer) override;
+    bool GetScreenBounds(SDL_Rect& bounds) const override;
 
     void SetVertices(std::vector<Vector2> vertices) { mVertices = vertices; }
     std::vector<Vector2>& GetVertices() { return mVertices; }
@@ -5,6 +5,7 @@
 #include "DrawSpriteComponent.h"
 #include "../../Actors/Actor.h"
 #include "../../Game.h"
+#include "../../SpriteBatch.h"
 
 DrawSpriteComponent::DrawSpriteComponent(class Actor* owner, const std::string &texturePath, const int width,
                                          const int height, const int drawOrder)
@@ -12,16 +13,41 @@ DrawSpriteComponent::DrawSpriteComponent(class Actor* owner, const std::string &
     ,mWidth(width)
     ,mHeight(height)
 {
-    mSpriteSheetSurface = GetGame()->LoadTexture(texturePath);
+    mSpriteSheetSurface = GetGame()->LoadTexture(texturePath, mTextureRegion);
 }
 
 DrawSpriteComponent::~DrawSpriteComponent() {
     if (mSpriteSheetSurface) {
-        SDL_DestroyTexture(mSpriteSheetSurface);
+        GetGame()->ReleaseTexture(mSpriteSheetSurface);
         mSpriteSheetSurface = nullptr;
     }
 }
 
+bool DrawSpriteComponent::GetScreenBounds(SDL_Rect& bounds) const
+{
+    // Rotação 0 ou Pi só espelha o sprite
+    float rotation = mOwner->GetRotation();
+    ComputeScreenBounds(rotation != 0.0f && rotation != Math::Pi, bounds);
+    return true;
+}
+
+void DrawSpriteComponent::ComputeScreenBounds(bool isRotated, SDL_Rect& bounds) const
+{
+    Vector2 screenPos = mOwner->GetRenderPosition() - mOwner->GetGame()->GetCamera()->GetRenderPosCamera();
+
+    float width = static_cast<float>(mWidth);
+    float height = static_cast<float>(mHeight);
+    if (isRotated) {
+        width = Math::Sqrt(width * width + height * height);
+        height = width;
+    }
+
+    bounds.x = static_cast<int>(screenPos.x - width / 2);
+    bounds.y = static_cast<int>(screenPos.y - height / 2);
+    bounds.w = static_cast<int>(width) + 1;
+    bounds.h = static_cast<int>(height) + 1;
+}
+
 void DrawSpriteComponent::Draw(SDL_Renderer* renderer)
 {
     if (!mIsVisible) {
@@ -31,13 +57,14 @@ void DrawSpriteComponent::Draw(SDL_Renderer* renderer)
     SDL_Rect dstRect;
     dstRect.h = mHeight;
     dstRect.w = mWidth;
-    dstRect.x = mOwner->GetPosition().x - mWidth / 2 - GetGame()->GetCamera()->GetPosCamera().x;
-    dstRect.y = mOwner->GetPosition().y - mHeight / 2 - GetGame()->GetCamera()->GetPosCamera().y;
+    Vector2 screenPos = mOwner->GetRenderPosition() - GetGame()->GetCamera()->GetRenderPosCamera();
+    dstRect.x = screenPos.x - mWidth / 2;
+    dstRect.y = screenPos.y - mHeight / 2;
 
     SDL_RendererFlip flip = SDL_FLIP_NONE;
     if (GetOwner()->GetRotation() == Math::Pi) {
         flip = SDL_FLIP_HORIZONTAL;
     }
 
-    SDL_RenderCopyEx(renderer, mSpriteSheetSurface, nullptr, &dstRect, 0.0f, nullptr, flip);
+    GetGame()->GetSpriteBatch()->Draw(mSpriteSheetSurface, &mTextureRegion, dstRect, 0.0f, flip);
 }
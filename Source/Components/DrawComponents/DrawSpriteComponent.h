@@ -16,12 +16,19 @@ public:
     ~DrawSpriteComponent() override;
 
     void Draw(SDL_Renderer* renderer) override;
+    bool GetScreenBounds(SDL_Rect& bounds) const override;
 
     void SetWidth(float width) { mWidth = static_cast<int>(width); }
     void SetHeight(float height) { mHeight = static_cast<int>(height); }
 
 protected:
+    // Rectangle of mWidth x mHeight centered on the owner. When rotated, the square
+    // that contains the sprite at any angle
+    void ComputeScreenBounds(bool isRotated, SDL_Rect& bounds) const;
+
     SDL_Texture* mSpriteSheetSurface;
+    // Area of mSpriteSheetSurface with the image (a region of an atlas page when packed)
+    SDL_Rect mTextureRegion;
 
     int mWidth;
     int mHeight;
@@ -4,54 +4,72 @@
 
 #include "RigidBodyComponent.h"
 #include "../Actors/Actor.h"
-#include "../Components/AABBComponent.h"
+#include "../Game.h"
+#include "../RigidBodySystem.h"
+#include "../LevelSnapshot.h"
 
 RigidBodyComponent::RigidBodyComponent(class Actor* owner, float mass, float maxSpeedX, float maxSpeedY, int updateOrder)
     :Component(owner, updateOrder)
-    ,mMass(mass)
-    ,mAngularSpeed(0.0f)
-    ,mMaxSpeedX(maxSpeedX)
-    ,mMaxSpeedY(maxSpeedY)
-    ,mVelocity(Vector2::Zero)
-    ,mAcceleration(Vector2::Zero)
+    ,mSystem(owner->GetGame()->GetRigidBodies())
+    ,mHandle(-1)
 {
+    mHandle = mSystem->Add(owner, mass, maxSpeedX, maxSpeedY);
 }
 
-void RigidBodyComponent::ApplyForce(const Vector2 &force) {
-    mAcceleration += force * (1.0f / mMass);
+RigidBodyComponent::~RigidBodyComponent()
+{
+    mSystem->Remove(mHandle);
 }
 
-void RigidBodyComponent::Update(float deltaTime) {
-    Vector2 position = mOwner->GetPosition();
+Vector2 RigidBodyComponent::GetVelocity() const { return mSystem->GetVelocity(mHandle); }
+
+void RigidBodyComponent::SetVelocity(const Vector2 &velocity) { mSystem->SetVelocity(mHandle, velocity); }
+
+Vector2 RigidBodyComponent::GetAcceleration() const { return mSystem->GetAcceleration(mHandle); }
+
+void RigidBodyComponent::SetAcceleration(const Vector2 &acceleration) { mSystem->SetAcceleration(mHandle, acceleration); }
+
+void RigidBodyComponent::SetAngularSpeed(const float speed) { mSystem->SetAngularSpeed(mHandle, speed); }
 
-    mVelocity += mAcceleration * deltaTime;
+float RigidBodyComponent::GetAngularSpeed() const { return mSystem->GetAngularSpeed(mHandle); }
 
-    if (Math::Abs(mVelocity.x) > mMaxSpeedX) {
-        if (mVelocity.x > 0) {
-            mVelocity.x = mMaxSpeedX;
-        }
-        else {
-            mVelocity.x = -mMaxSpeedX;
-        }
-    }
+void RigidBodyComponent::SetMaxSpeedX(float v) { mSystem->SetMaxSpeedX(mHandle, v); }
 
-    if (Math::Abs(mVelocity.y) > mMaxSpeedY) {
-        if (mVelocity.y > 0) {
-            mVelocity.y = mMaxSpeedY;
-        }
-        else {
-            mVelocity.y = -mMaxSpeedY;
-        }
-    }
+void RigidBodyComponent::SetMaxSpeedY(float v) { mSystem->SetMaxSpeedY(mHandle, v); }
 
-    position += mVelocity * deltaTime;
+float RigidBodyComponent::GetMaxSpeedX() const { return mSystem->GetMaxSpeedX(mHandle); }
 
-    mOwner->SetPosition(position);
+float RigidBodyComponent::GetMaxSpeedY() const { return mSystem->GetMaxSpeedY(mHandle); }
 
-    mAcceleration.Set(0.0f, 0.0f);
+void RigidBodyComponent::ApplyForce(const Vector2 &force) { mSystem->ApplyForce(mHandle, force); }
 
-    float rot = mOwner->GetRotation();
-    rot += mAngularSpeed * deltaTime;
+Vector2 RigidBodyComponent::GetLastDisplacement() const { return mSystem->GetLastDisplacement(mHandle); }
+
+void RigidBodyComponent::SaveState(LevelSnapshot& snapshot) const
+{
+    snapshot.Write(GetVelocity());
+    snapshot.Write(GetAcceleration());
+    snapshot.Write(GetAngularSpeed());
+    snapshot.Write(GetMaxSpeedX());
+    snapshot.Write(GetMaxSpeedY());
+}
+
+void RigidBodyComponent::LoadState(LevelSnapshot& snapshot)
+{
+    Vector2 velocity;
+    Vector2 acceleration;
+    float angularSpeed;
+    float maxSpeedX;
+    float maxSpeedY;
+    snapshot.Read(velocity);
+    snapshot.Read(acceleration);
+    snapshot.Read(angularSpeed);
+    snapshot.Read(maxSpeedX);
+    snapshot.Read(maxSpeedY);
 
-    mOwner->SetRotation(rot);
+    SetVelocity(velocity);
+    SetAcceleration(acceleration);
+    SetAngularSpeed(angularSpeed);
+    SetMaxSpeedX(maxSpeedX);
+    SetMaxSpeedY(maxSpeedY);
 }
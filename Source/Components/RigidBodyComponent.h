@@ -7,37 +7,39 @@
 #include "Component.h"
 #include "../Math.h"
 
+// Handle to a body in the game's RigidBodySystem, which integrates every body in one pass
+// at the start of Game::UpdateActors (before any actor updates, as this component's low
+// update order used to guarantee)
 class RigidBodyComponent : public Component
 {
 public:
     // Lower update order to update first
     RigidBodyComponent(class Actor* owner, float mass = 1.0f, float maxSpeedX = 10000, float maxSpeedY = 10000, int updateOrder = 10);
+    ~RigidBodyComponent() override;
 
-    void Update(float deltaTime) override;
+    Vector2 GetVelocity() const;
+    void SetVelocity(const Vector2 &velocity);
 
-    const Vector2 &GetVelocity() const { return mVelocity; }
-    void SetVelocity(const Vector2 &velocity) { mVelocity = velocity; }
+    Vector2 GetAcceleration() const;
+    void SetAcceleration(const Vector2 &acceleration);
 
-    const Vector2 &GetAcceleration() const { return mAcceleration; }
-    void SetAcceleration(const Vector2 &acceleration) { mAcceleration = acceleration; }
+    void SetAngularSpeed(const float speed);
+    float GetAngularSpeed() const;
 
-    void SetAngularSpeed(const float speed) { mAngularSpeed = speed; }
-    float GetAngularSpeed() const { return mAngularSpeed; }
-
-    void SetMaxSpeedX(float v) { mMaxSpeedX = v; }
-    void SetMaxSpeedY(float v) { mMaxSpeedY = v; }
-    float GetMaxSpeedX() const { return mMaxSpeedX; }
-    float GetMaxSpeedY() const { return mMaxSpeedY; }
+    void SetMaxSpeedX(float v);
+    void SetMaxSpeedY(float v);
+    float GetMaxSpeedX() const;
+    float GetMaxSpeedY() const;
 
     void ApplyForce(const Vector2 &force);
 
+    // How much the owner moved in the last Update (used by swept collision)
+    Vector2 GetLastDisplacement() const;
+
+    void SaveState(class LevelSnapshot& snapshot) const override;
+    void LoadState(class LevelSnapshot& snapshot) override;
+
 private:
-    // Physical properties
-    float mMass;
-    float mAngularSpeed;
-    float mMaxSpeedX;
-    float mMaxSpeedY;
-
-    Vector2 mVelocity;
-    Vector2 mAcceleration;
+    class RigidBodySystem* mSystem;
+    int mHandle;
 };
@@ -0,0 +1,56 @@
+#include "DrawList.h"
+#include "Components/DrawComponents/DrawComponent.h"
+#include <algorithm>
+
+DrawList::DrawList()
+    :mSize(0)
+{
+}
+
+DrawList::Bucket* DrawList::FindBucket(int drawOrder)
+{
+    auto iter = std::lower_bound(mBuckets.begin(), mBuckets.end(), drawOrder, [](const Bucket& bucket, int order) {
+        return bucket.mDrawOrder < order;
+    });
+    if (iter == mBuckets.end() || iter->mDrawOrder != drawOrder) {
+        return nullptr;
+    }
+    return &(*iter);
+}
+
+void DrawList::Add(class DrawComponent* drawable)
+{
+    int drawOrder = drawable->GetDrawOrder();
+    Bucket* bucket = FindBucket(drawOrder);
+    if (!bucket) {
+        // Draw order nova: poucas existem, então inserir ordenado é barato
+        auto iter = std::lower_bound(mBuckets.begin(), mBuckets.end(), drawOrder, [](const Bucket& b, int order) {
+            return b.mDrawOrder < order;
+        });
+        bucket = &(*mBuckets.insert(iter, Bucket{drawOrder, {}}));
+    }
+
+    drawable->SetDrawListIndex(static_cast<int>(bucket->mDrawables.size()));
+    bucket->mDrawables.emplace_back(drawable);
+    mSize++;
+}
+
+void DrawList::Remove(class DrawComponent* drawable)
+{
+    Bucket* bucket = FindBucket(drawable->GetDrawOrder());
+    int index = drawable->GetDrawListIndex();
+    if (!bucket || index < 0 || index >= static_cast<int>(bucket->mDrawables.size()) ||
+        bucket->mDrawables[index] != drawable)
+    {
+        return;
+    }
+
+    // Troca com o último do bucket para remover sem deslocar os outros
+    DrawComponent* last = bucket->mDrawables.back();
+    bucket->mDrawables[index] = last;
+    last->SetDrawListIndex(index);
+    bucket->mDrawables.pop_back();
+
+    drawable->SetDrawListIndex(-1);
+    mSize--;
+}
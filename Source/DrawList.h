@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+// Draw components grouped in buckets by draw order, buckets sorted from back to front.
+// Adding a drawable only appends it to its bucket, and removing swaps it with the last one
+// of the bucket using the index stored in the component, so neither re-sorts the list.
+// The order inside a bucket is not defined, as drawables with the same draw order never
+// had a defined order between them.
+class DrawList
+{
+public:
+    struct Bucket
+    {
+        int mDrawOrder;
+        std::vector<class DrawComponent*> mDrawables;
+    };
+
+    DrawList();
+
+    void Add(class DrawComponent* drawable);
+    void Remove(class DrawComponent* drawable);
+
+    const std::vector<Bucket>& GetBuckets() const { return mBuckets; }
+    int GetSize() const { return mSize; }
+
+private:
+    // Bucket with the given draw order, or nullptr
+    Bucket* FindBucket(int drawOrder);
+
+    std::vector<Bucket> mBuckets;
+    int mSize;
+};
@@ -0,0 +1,120 @@
+#include "FramePacer.h"
+#include <algorithm>
+
+FramePacer::FramePacer(float targetRate, Mode mode)
+    :mMode(mode)
+    ,mTargetRate(60.0f)
+    ,mFrequency(SDL_GetPerformanceFrequency())
+    ,mFrameStart(SDL_GetPerformanceCounter())
+    ,mSpinThreshold(0.002)
+    ,mLastFrameTime(0.0f)
+    ,mHistoryIndex(0)
+    ,mNumSamples(0)
+{
+    SetTargetRate(targetRate);
+    std::fill(mHistory, mHistory + HISTORY_SIZE, 0.0f);
+    mSortScratch.reserve(HISTORY_SIZE);
+}
+
+void FramePacer::SetTargetRate(float targetRate)
+{
+    if (targetRate > 0.0f) {
+        mTargetRate = targetRate;
+    }
+}
+
+void FramePacer::Reset()
+{
+    mFrameStart = SDL_GetPerformanceCounter();
+}
+
+float FramePacer::WaitForNextFrame()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (mMode == Mode::Limit) {
+        double frameDuration = 1.0 / mTargetRate;
+        double remaining = frameDuration - CounterToSeconds(now - mFrameStart);
+
+        // Dorme a maior parte do tempo restante; SDL_Delay pode passar do ponto, então sobra uma margem
+        if (remaining > mSpinThreshold) {
+            SDL_Delay(static_cast<Uint32>((remaining - mSpinThreshold) * 1000.0));
+        }
+
+        // Termina a espera girando no contador de alta resolução
+        now = SDL_GetPerformanceCounter();
+        while (CounterToSeconds(now - mFrameStart) < frameDuration) {
+            now = SDL_GetPerformanceCounter();
+        }
+    }
+
+    mLastFrameTime = static_cast<float>(CounterToSeconds(now - mFrameStart));
+    mFrameStart = now;
+
+    mHistory[mHistoryIndex] = mLastFrameTime;
+    mHistoryIndex = (mHistoryIndex + 1) % HISTORY_SIZE;
+    if (mNumSamples < HISTORY_SIZE) {
+        mNumSamples++;
+    }
+
+    return mLastFrameTime;
+}
+
+float FramePacer::GetAverageFrameTime() const
+{
+    if (mNumSamples == 0) {
+        return 0.0f;
+    }
+
+    float sum = 0.0f;
+    for (int i = 0; i < mNumSamples; i++) {
+        sum += mHistory[i];
+    }
+    return sum / static_cast<float>(mNumSamples);
+}
+
+float FramePacer::GetMinFrameTime() const
+{
+    if (mNumSamples == 0) {
+        return 0.0f;
+    }
+    return *std::min_element(mHistory, mHistory + mNumSamples);
+}
+
+float FramePacer::GetMaxFrameTime() const
+{
+    if (mNumSamples == 0) {
+        return 0.0f;
+    }
+    return *std::max_element(mHistory, mHistory + mNumSamples);
+}
+
+float FramePacer::GetFrameTimePercentile(float percentile)
+{
+    if (mNumSamples == 0) {
+        return 0.0f;
+    }
+
+    percentile = std::min(std::max(percentile, 0.0f), 1.0f);
+
+    mSortScratch.assign(mHistory, mHistory + mNumSamples);
+    auto nth = mSortScratch.begin() + static_cast<int>(percentile * static_cast<float>(mNumSamples - 1));
+    std::nth_element(mSortScratch.begin(), nth, mSortScratch.end());
+    return *nth;
+}
+
+void FramePacer::GetFrameTimeHistory(std::vector<float>& frameTimes) const
+{
+    frameTimes.clear();
+
+    // Quando o buffer ainda não encheu, o mais antigo está no índice 0
+    int start = mNumSamples < HISTORY_SIZE ? 0 : mHistoryIndex;
+    for (int i = 0; i < mNumSamples; i++) {
+        frameTimes.emplace_back(mHistory[(start + i) % HISTORY_SIZE]);
+    }
+}
+
+double FramePacer::CounterToSeconds(Uint64 counter) const
+{
+    return static_cast<double>(counter) / static_cast<double>(mFrequency);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+// Paces the main loop using SDL's high-resolution performance counter.
+// In Limit mode the remaining frame time is slept with SDL_Delay, leaving a small margin
+// that is then spun away, so frames end on time even though SDL_Delay oversleeps.
+// In VSync mode SDL_RenderPresent already blocks, so the pacer only measures.
+// The last frame times are kept for statistics.
+class FramePacer
+{
+public:
+    enum class Mode
+    {
+        VSync,
+        Limit,
+        Unlimited
+    };
+
+    FramePacer(float targetRate, Mode mode);
+
+    void SetMode(Mode mode) { mMode = mode; }
+    Mode GetMode() const { return mMode; }
+
+    // Frames per second targeted in Limit mode
+    void SetTargetRate(float targetRate);
+    float GetTargetRate() const { return mTargetRate; }
+
+    // Restarts the frame clock, e.g. after a long load, so the next frame time is not huge
+    void Reset();
+
+    // Waits for the end of the current frame (Limit mode only) and returns,
+    // in seconds, how long it took since the previous call
+    float WaitForNextFrame();
+
+    // Frame time statistics, in seconds, over the last frames
+    float GetLastFrameTime() const { return mLastFrameTime; }
+    float GetAverageFrameTime() const;
+    float GetMinFrameTime() const;
+    float GetMaxFrameTime() const;
+    // percentile in [0, 1], e.g. 0.99 for the 99th percentile
+    float GetFrameTimePercentile(float percentile);
+    int GetNumSamples() const { return mNumSamples; }
+
+    // Copies the stored frame times, oldest first
+    void GetFrameTimeHistory(std::vector<float>& frameTimes) const;
+
+    static const int HISTORY_SIZE = 240;
+
+private:
+    double CounterToSeconds(Uint64 counter) const;
+
+    Mode mMode;
+    float mTargetRate;
+
+    Uint64 mFrequency;
+    Uint64 mFrameStart;
+
+    // Below this much remaining time the pacer spins instead of calling SDL_Delay
+    double mSpinThreshold;
+
+    float mLastFrameTime;
+
+    // Ring buffer with the last frame times
+    float mHistory[HISTORY_SIZE];
+    int mHistoryIndex;
+    int mNumSamples;
+
+    // Reused by GetFrameTimePercentile to avoid allocating every call
+    std::vector<float> mSortScratch;
+};
@@ -1,16 +1,33 @@
 #include <algorithm>
+#include <cmath>
+#include <typeinfo>
 #include <vector>
 #include "Game.h"
 // #include "Components/DrawComponent.h"
 #include "Components/DrawComponents/DrawComponent.h"
 #include "Components/RigidBodyComponent.h"
 #include "Random.h"
-#include "Actors/ParticleSystem.h"
 #include <iostream>
 #include <fstream>
+#include <filesystem>
 #include <map>
 #include "CSV.h"
 #include "Json.h"
+#include "TextureCache.h"
+#include "SpriteSheetAsset.h"
+#include "GroundGrid.h"
+#include "TileCollisionLayer.h"
+#include "TileChunkLayer.h"
+#include "SpriteBatch.h"
+#include "RigidBodySystem.h"
+#include "ParticleEngine.h"
+#include "LevelSnapshot.h"
+#include "LevelFile.h"
+#include "FramePacer.h"
+#include "InputScript.h"
+#include "InputRecorder.h"
+#include "Profiler.h"
+#include "PerfOverlay.h"
 #include <SDL_image.h>
 #include <SDL_ttf.h>
 #include <SDL_mixer.h>
@@ -32,6 +49,7 @@
 #include "Actors/Projectile.h"
 #include "Components/AABBComponent.h"
 #include "Components/DrawComponents/DrawAnimatedComponent.h"
+#include "Components/DrawComponents/DrawGroundSpritesComponent.h"
 
 
 std::vector<int> ParseIntList(const std::string& str) {
@@ -56,16 +74,34 @@ Game::Game(int windowWidth, int windowHeight, int FPS)
     ,mWindowHeight(windowHeight)
     ,mLogicalWindowWidth(windowWidth)
     ,mLogicalWindowHeight(windowHeight)
-    ,mTicksCount(0)
+    ,mFramePacer(nullptr)
+    ,mSpriteBatch(nullptr)
+    ,mPerfOverlay(nullptr)
+    ,mDrawCalls(0)
+    ,mLastDrawCalls(0)
+    ,mLastUpdateTime(0.0f)
+    ,mLastDrawTime(0.0f)
+    ,mLastPresentTime(0.0f)
+    ,mIsHeadless(false)
+    ,mInputScript(nullptr)
+    ,mInputRecorder(nullptr)
+    ,mHasRandomSeed(false)
+    ,mRandomSeed(0)
+    ,mSimulationStep(0)
+    ,mMaxSimulationSteps(0)
     ,mIsRunning(true)
     ,mUpdatingActors(false)
     ,mFPS(FPS)
+    ,mFixedDeltaTime(1.0f / static_cast<float>(FPS))
+    ,mTimeAccumulator(0.0f)
+    ,mRenderAlpha(1.0f)
     ,mIsPaused(false)
     ,mCamera(nullptr)
     ,mPlayer(nullptr)
     ,mLevelData(nullptr)
     ,mLevelDataDynamicGrounds(nullptr)
     ,mTileSheet(nullptr)
+    ,mLevelFile(nullptr)
     ,mController(nullptr)
     ,mHitstopActive(false)
     ,mHitstopDuration(0.15f)
@@ -90,6 +126,30 @@ Game::Game(int windowWidth, int windowHeight, int FPS)
     ,mBackGroundTextureLevel4(nullptr)
     ,mUseParallaxBackground(false)
     ,mAudio(nullptr)
+    ,mTextureCache(nullptr)
+    ,mGroundGrid(nullptr)
+    ,mRigidBodies(nullptr)
+    ,mTileCollision(nullptr)
+    ,mTileChunks(nullptr)
+    ,mParticles(nullptr)
+    ,mLevelSnapshot(nullptr)
+    ,mLoadingObjectId(-1)
+    ,mIsRestoringLevel(false)
+    ,mFireBallPool(1, [this](int) {
+        auto* fireBall = new FireBall(this);
+        fireBall->SetIsPersistent(true);
+        return fireBall;
+    })
+    ,mProjectilePool(2, [this](int type) {
+        auto* projectile = new Projectile(this, static_cast<Projectile::ProjectileType>(type));
+        projectile->SetIsPersistent(true);
+        return projectile;
+    })
+    ,mMoneyPool(3, [this](int type) {
+        auto* money = new Money(this, static_cast<Money::MoneyType>(type));
+        money->SetIsPersistent(true);
+        return money;
+    })
     ,mHUD(nullptr)
     ,mPauseMenu(nullptr)
     ,mSceneManagerState(SceneManagerState::None)
@@ -104,25 +164,23 @@ Game::Game(int windowWidth, int windowHeight, int FPS)
 
 bool Game::Initialize()
 {
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER) != 0)
+    if (mIsHeadless) {
+        // Driver de vídeo sem display: eventos e teclado funcionam, mas nenhuma janela é aberta
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+    }
+
+    Uint32 initFlags = mIsHeadless ? SDL_INIT_VIDEO : SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER;
+    if (SDL_Init(initFlags) != 0)
     {
         SDL_Log("Unable to initialize SDL: %s", SDL_GetError());
         return false;
     }
 
-    mWindow = SDL_CreateWindow("Echoes of Elementum", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-                               mWindowWidth, mWindowHeight,
-                               // SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
-                               SDL_WINDOW_FULLSCREEN_DESKTOP | SDL_WINDOW_RESIZABLE);
-
-    if (!mWindow) {
-        SDL_Log("Failed to create window: %s", SDL_GetError());
-        return false;
+    if (mIsHeadless) {
+        // Sem renderer não há limite de quadros: a simulação roda o mais rápido possível
+        mFramePacer = new FramePacer(static_cast<float>(mFPS), FramePacer::Mode::Unlimited);
     }
-
-    mRenderer = SDL_CreateRenderer(mWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-    if (!mRenderer) {
-        SDL_Log("Failed to create renderer: %s", SDL_GetError());
+    else if (!CreateWindowAndRenderer()) {
         return false;
     }
 
@@ -131,6 +189,11 @@ bool Game::Initialize()
         return false;
     }
 
+    mTextureCache = new TextureCache(mRenderer);
+    if (mRenderer) {
+        mTextureCache->LoadAtlas(mAtlasManifestPath, "../Assets/");
+    }
+
     // Initialize SDL_ttf
     if (TTF_Init() != 0)
     {
@@ -139,7 +202,7 @@ bool Game::Initialize()
     }
 
     // Initialize SDL_mixer
-    if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) == -1) {
+    if (!mIsHeadless && Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) == -1) {
         SDL_Log("Failed to initialize SDL_mixer");
         return false;
     }
@@ -161,12 +224,20 @@ bool Game::Initialize()
         mScale = static_cast<float>(tileSize) / mOriginalTileSize;
     }
 
+    mTileSize = static_cast<int>(mOriginalTileSize * mScale);
+    mGroundGrid = new GroundGrid(static_cast<float>(mTileSize * mGroundGridCellTiles));
+    mRigidBodies = new RigidBodySystem();
+    mTileCollision = new TileCollisionLayer();
+    mTileChunks = new TileChunkLayer(mRenderer);
+    mSpriteBatch = new SpriteBatch(mRenderer);
+    mParticles = new ParticleEngine(this);
+    mLevelSnapshot = new LevelSnapshot();
 
     // Esconde o cursor
     // SDL_ShowCursor(SDL_DISABLE);
 
-    // Inicializa controle
-    for (int i = 0; i < SDL_NumJoysticks(); ++i)
+    // Inicializa controle (não durante replays, já que só o teclado é gravado)
+    for (int i = 0; i < SDL_NumJoysticks() && !mInputScript; ++i)
     {
         if (SDL_IsGameController(i))
         {
@@ -176,10 +247,16 @@ bool Game::Initialize()
         }
     }
 
-    Random::Init();
+    // Replays usam a mesma semente da gravação para que a partida se repita
+    if (mHasRandomSeed) {
+        Random::Seed(mRandomSeed);
+    }
+    else {
+        Random::Init();
+    }
 
     // Load Audios
-    mAudio = new AudioSystem(16);
+    mAudio = new AudioSystem(16, mIsHeadless);
     mAudio->CacheSound("Hornet.wav");
     mAudio->CacheSound("MantisLords.wav");
     mAudio->CacheSound("HollowKnight.wav");
@@ -221,7 +298,7 @@ bool Game::Initialize()
     mBackgroundLayersLevel4.emplace_back(LoadTexture(backgroundAssets + "Level4/6.png"));
     mBackgroundLayersLevel4.emplace_back(LoadTexture(backgroundAssets + "Level4/7.png"));
 
-    mTicksCount = SDL_GetTicks();
+    mFramePacer->Reset();
 
     SetGameScene(GameScene::MainMenu);
 
@@ -275,8 +352,12 @@ void Game::ResetGameScene(float transitionTime)
 
 void Game::ChangeScene()
 {
+    PROFILE_SCOPE("ChangeScene");
+    // Recarregar a mesma fase (ex.: depois de morrer) reaproveita os dados já lidos dela
+    bool isLevelReset = mNextScene == mGameScene && mNextScene != GameScene::MainMenu;
+
     // Unload current Scene
-    UnloadScene();
+    UnloadScene(isLevelReset);
 
     mIsSlowMotion = false;
     mIsAccelerated = false;
@@ -289,34 +370,15 @@ void Game::ChangeScene()
     const std::string levelsAssets = "../Assets/Levels/";
 
     if (mNextScene != GameScene::MainMenu) {
-        // Pool de Fireballs
-        for (int i = 0; i < 10; i++) {
-            new FireBall(this);
-        }
+        // Pools: tamanho inicial e até quanto podem crescer (só cria objetos na primeira fase)
+        mFireBallPool.Reserve(0, 10, 20);
 
-        // Pool de Partículas
-        for (int i = 0; i < 200; i++) {
-            new Particle(this);
-        }
-
-        // Pool de Projectiles
-        for (int i = 0; i < 50; i++) {
-            new Projectile(this, Projectile::ProjectileType::Acid);
-        }
-        for (int i = 0; i < 50; i++) {
-            new Projectile(this, Projectile::ProjectileType::OrangeBall);
-        }
+        mProjectilePool.Reserve(static_cast<int>(Projectile::ProjectileType::Acid), 50, 100);
+        mProjectilePool.Reserve(static_cast<int>(Projectile::ProjectileType::OrangeBall), 50, 100);
 
-        // Pool de Moneys
-        for (int i = 0; i < 50; i++) {
-            new Money(this, Money::MoneyType::Small);
-        }
-        for (int i = 0; i < 50; i++) {
-            new Money(this, Money::MoneyType::Medium);
-        }
-        for (int i = 0; i < 50; i++) {
-            new Money(this, Money::MoneyType::Large);
-        }
+        mMoneyPool.Reserve(static_cast<int>(Money::MoneyType::Small), 50, 100);
+        mMoneyPool.Reserve(static_cast<int>(Money::MoneyType::Medium), 50, 100);
+        mMoneyPool.Reserve(static_cast<int>(Money::MoneyType::Large), 50, 100);
 
         // não carrega companheiro na última fase
         if (mNextScene != GameScene::Level5) {
@@ -509,6 +571,9 @@ void Game::ChangeScene()
         }
     }
 
+    // Descarta texturas que a cena anterior usava e a nova não usa mais
+    mTextureCache->EvictUnused();
+
     // Set new scene
     mGameScene = mNextScene;
 }
@@ -764,14 +829,27 @@ void Game::LoadOptionsMenu() {
     // text = mOptionsMenu->AddText(optionValue, Vector2::Zero, Vector2::Zero, buttonPointSize);
     // text->SetPosition(Vector2(optionPosX, button->GetPosition().y));
 
-    name = "TECLADO";
+    // Sem vsync o FramePacer limita a taxa de quadros sozinho
+    bool isVSync = mFramePacer->GetMode() == FramePacer::Mode::VSync;
+    name = "VSYNC";
     button = mOptionsMenu->AddButton(name, buttonPos + Vector2(0, buttonSize.y * 3.0f), buttonSize, buttonPointSize, UIButton::TextPos::AlignLeft,
+    [this, isVSync]() {
+        SetVSync(!isVSync);
+        mOptionsMenu->Close();
+        LoadOptionsMenu();
+    }, textPos);
+    optionValue = isVSync ? "ON" : "OFF";
+    text = mOptionsMenu->AddText(optionValue, Vector2::Zero, Vector2::Zero, buttonPointSize);
+    text->SetPosition(Vector2(optionPosX, button->GetPosition().y));
+
+    name = "TECLADO";
+    button = mOptionsMenu->AddButton(name, buttonPos + Vector2(0, buttonSize.y * 4.5f), buttonSize, buttonPointSize, UIButton::TextPos::AlignLeft,
     [this]() {
         LoadKeyBoardMenu();
     }, textPos);
 
     name = "CONTROLE";
-    button = mOptionsMenu->AddButton(name, buttonPos + Vector2(0, buttonSize.y * 4.5f), buttonSize, buttonPointSize, UIButton::TextPos::AlignLeft,
+    button = mOptionsMenu->AddButton(name, buttonPos + Vector2(0, buttonSize.y * 6.0f), buttonSize, buttonPointSize, UIButton::TextPos::AlignLeft,
     [this]() {
         LoadControlMenu();
     }, textPos);
@@ -826,373 +904,186 @@ void Game::LoadKeyBoardMenu() {
 
 
 
-void Game::LoadObjects(const std::string &fileName) {
-    std::ifstream file(fileName);
-    if (!file.is_open()) {
-        SDL_Log("Erro ao abrir o arquivo");
-        return;
-    }
-    nlohmann::json mapData;
-    file >> mapData;
-    Ground* ground;
-    for (const auto &layer: mapData["layers"]) {
-        if (layer["name"] == "Grounds") {
-            for (const auto &obj: layer["objects"]) {
-                std::string name = obj["name"];
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
-                float width = static_cast<float>(obj["width"]) * mScale;
-                float height = static_cast<float>(obj["height"]) * mScale;
-                int id = obj["id"];
-                bool isSpike = false;
-                bool isMoving = false;
-                float respawnPositionX = 0.0f;
-                float respawnPositionY = 0.0f;
-                float movingDuration = 0.0f;
-                float speedX = 0.0f;
-                float speedY = 0.0f;
-                float growSpeedX = 0.0f;
-                float growSpeedY = 0.0f;
-                int growthDirection = 0;
-                float minHeight = 0.0f;
-                float minWidth = 0.0f;
-                bool isOscillating = false;
-
-                if (obj.contains("properties")) {
-                    for (const auto &prop: obj["properties"]) {
-                        std::string propName = prop["name"];
-                        if (propName == "Spike") {
-                            isSpike = prop["value"];
-                        }
-                        else if (propName == "Moving") {
-                            isMoving = prop["value"];
-                        }
-                        else if (propName == "RespawnPositionX") {
-                            respawnPositionX = static_cast<float>(prop["value"]) * mScale;
-                        }
-                        else if (propName == "RespawnPositionY") {
-                            respawnPositionY = static_cast<float>(prop["value"]) * mScale;
-                        }
-                        else if (propName == "MovingDuration") {
-                            movingDuration = prop["value"];
-                        }
-                        else if (propName == "SpeedX") {
-                            speedX = prop["value"];
-                        }
-                        else if (propName == "SpeedY") {
-                            speedY = prop["value"];
-                        }
-                        else if (propName == "GrowSpeedX") {
-                            growSpeedX = static_cast<float>(prop["value"]);
-                        }
-                        else if (propName == "GrowSpeedY") {
-                            growSpeedY = static_cast<float>(prop["value"]);
-                        }
-                        else if (propName == "GrowthDirection") {
-                            growthDirection = static_cast<int>(prop["value"]);
-                        }
-                        else if (propName == "MinHeight") {
-                            minHeight = static_cast<float>(prop["value"]) * mScale;
-                        }
-                        else if (propName == "MinWidth") {
-                            minWidth = static_cast<float>(prop["value"]) * mScale;
-                        }
-                        else if (propName == "Oscillate") {
-                            isOscillating = static_cast<float>(prop["value"]);
-                        }
-                    }
-                }
+void Game::LoadObjects(const LevelFile &level) {
+    PROFILE_SCOPE("LoadObjects");
+    const LevelObject* objects = level.GetObjects();
+    for (int i = 0; i < level.GetNumObjects(); i++) {
+        const LevelObject& obj = objects[i];
+        // O player não entra no snapshot
+        if (obj.mType == LevelObjectType::Player) {
+            mLoadingObjectId = -1;
+        }
+        else if (!BeginLevelObject(obj.mId)) {
+            continue;
+        }
 
-                if (name == "DynamicGround") {
-                    auto* dynamicGround = new DynamicGround(this, minWidth, minHeight, isSpike, isMoving, movingDuration, Vector2(speedX, speedY));
-                    dynamicGround->SetId(id);
-                    dynamicGround->SetRespawPosition(Vector2(respawnPositionX, respawnPositionY));
-                    dynamicGround->SetIsOscillating(isOscillating);
-                    dynamicGround->SetMaxWidth(width);
-                    dynamicGround->SetMaxHeight(height);
-                    dynamicGround->SetMinWidth(minWidth);
-                    dynamicGround->SetMinHeight(minHeight);
-                    dynamicGround->SetGrowSpeed(Vector2(growSpeedX, growSpeedY));
-                    switch (growthDirection) {
-                        case 0:
-                            dynamicGround->SetGrowDirection(GrowthDirection::Up);
-                            dynamicGround->SetPosition(Vector2(x + width / 2, y + height - minHeight / 2));
-                        break;
-
-                        case 1:
-                            dynamicGround->SetGrowDirection(GrowthDirection::Down);
-                            dynamicGround->SetPosition(Vector2(x + width / 2, y + minHeight / 2));
-                        break;
-
-                        case 2:
-                            dynamicGround->SetGrowDirection(GrowthDirection::Left);
-                            dynamicGround->SetPosition(Vector2(x + width - minWidth / 2, y + height / 2));
-                        break;
-
-                        case 3:
-                            dynamicGround->SetGrowDirection(GrowthDirection::Right);
-                            dynamicGround->SetPosition(Vector2(x + minWidth / 2, y + height / 2));
-                        break;
-                    }
-                    dynamicGround->SetStartingPosition(Vector2(x + width / 2, y + height / 2));
-                    dynamicGround->SetSprites();
-                }
-                else {
-                    ground = new Ground(this, width, height, isSpike, isMoving, movingDuration, Vector2(speedX, speedY));
-                    ground->SetId(id);
-                    ground->SetPosition(Vector2(x + width / 2, y + height / 2));
-                    ground->SetRespawPosition(Vector2(respawnPositionX, respawnPositionY));
-                    ground->SetStartingPosition(Vector2(x + width / 2, y + height / 2));
-                    ground->SetSprites();
+        int id = obj.mId;
+        float x = obj.mX * mScale;
+        float y = obj.mY * mScale;
+        float width = obj.mWidth * mScale;
+        float height = obj.mHeight * mScale;
+
+        switch (obj.mType) {
+            case LevelObjectType::DynamicGround: {
+                float minWidth = obj.mMinWidth * mScale;
+                float minHeight = obj.mMinHeight * mScale;
+                auto* dynamicGround = new DynamicGround(this, minWidth, minHeight, obj.mIsSpike, obj.mIsMoving,
+                                                        obj.mMovingDuration, Vector2(obj.mSpeedX, obj.mSpeedY));
+                dynamicGround->SetId(id);
+                dynamicGround->SetRespawPosition(Vector2(obj.mRespawnPositionX, obj.mRespawnPositionY) * mScale);
+                dynamicGround->SetIsOscillating(obj.mIsOscillating);
+                dynamicGround->SetMaxWidth(width);
+                dynamicGround->SetMaxHeight(height);
+                dynamicGround->SetMinWidth(minWidth);
+                dynamicGround->SetMinHeight(minHeight);
+                dynamicGround->SetGrowSpeed(Vector2(obj.mGrowSpeedX, obj.mGrowSpeedY));
+                switch (obj.mGrowthDirection) {
+                    case 0:
+                        dynamicGround->SetGrowDirection(GrowthDirection::Up);
+                        dynamicGround->SetPosition(Vector2(x + width / 2, y + height - minHeight / 2));
+                    break;
+
+                    case 1:
+                        dynamicGround->SetGrowDirection(GrowthDirection::Down);
+                        dynamicGround->SetPosition(Vector2(x + width / 2, y + minHeight / 2));
+                    break;
+
+                    case 2:
+                        dynamicGround->SetGrowDirection(GrowthDirection::Left);
+                        dynamicGround->SetPosition(Vector2(x + width - minWidth / 2, y + height / 2));
+                    break;
+
+                    case 3:
+                        dynamicGround->SetGrowDirection(GrowthDirection::Right);
+                        dynamicGround->SetPosition(Vector2(x + minWidth / 2, y + height / 2));
+                    break;
                 }
+                dynamicGround->SetStartingPosition(Vector2(x + width / 2, y + height / 2));
+                dynamicGround->SetSprites();
+                break;
             }
-        }
-        if (layer["name"] == "Triggers") {
-            for (const auto &obj: layer["objects"]) {
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
-                float width = static_cast<float>(obj["width"]) * mScale;
-                float height = static_cast<float>(obj["height"]) * mScale;
-                std::string target;
-                std::string event;
-                std::string grounds;
-                std::string enemies;
-                std::vector<int> groundsIds;
-                std::vector<int> enemiesIds;
-                float fixedCameraPositionX = 0;
-                float fixedCameraPositionY = 0;
-                std::string scene;
-                std::string dialoguePath;
-                std::string cutsceneId;
-                if (obj.contains("properties")) {
-                    for (const auto &prop: obj["properties"]) {
-                        std::string propName = prop["name"];
-                        if (propName == "Target") {
-                            target = prop["value"];
-                        }
-                        else if (propName == "Event") {
-                            event = prop["value"];
-                        }
-                        else if (propName == "Grounds") {
-                            grounds = prop["value"];
-                        }
-                        else if (propName == "Enemies") {
-                            enemies = prop["value"];
-                        }
-                        else if (propName == "FixedCameraPositionX") {
-                            fixedCameraPositionX = prop["value"];
-                        }
-                        else if (propName == "FixedCameraPositionY") {
-                            fixedCameraPositionY = prop["value"];
-                        }
-                        else if (propName == "Scene") {
-                            scene = prop["value"];
-                        }
-                        else if (propName == "FilePath") {
-                            dialoguePath = prop["value"];
-                        }
-                        else if (propName == "CutsceneId") {
-                            cutsceneId = prop["value"];
-                        }
-                    }
-                }
-                groundsIds = ParseIntList(grounds);
-                enemiesIds = ParseIntList(enemies);
 
+            case LevelObjectType::Ground: {
+                auto* ground = new Ground(this, width, height, obj.mIsSpike, obj.mIsMoving, obj.mMovingDuration,
+                                          Vector2(obj.mSpeedX, obj.mSpeedY));
+                ground->SetId(id);
+                ground->SetPosition(Vector2(x + width / 2, y + height / 2));
+                ground->SetRespawPosition(Vector2(obj.mRespawnPositionX, obj.mRespawnPositionY) * mScale);
+                ground->SetStartingPosition(Vector2(x + width / 2, y + height / 2));
+                ground->SetSprites();
+                break;
+            }
+
+            case LevelObjectType::Trigger: {
                 auto* trigger = new Trigger(this, width, height);
                 trigger->SetPosition(Vector2(x + width / 2, y + height / 2));
-                trigger->SetTarget(target);
-                trigger->SetEvent(event);
-                trigger->SetGroundsIds(groundsIds);
-                trigger->SetEnemiesIds(enemiesIds);
-                trigger->SetFixedCameraPosition(Vector2(fixedCameraPositionX, fixedCameraPositionY));
-                trigger->SetScene(scene);
-                trigger->SetDialoguePath(dialoguePath);
-                trigger->SetCutsceneId(cutsceneId);
+                trigger->SetTarget(level.GetString(obj.mTarget));
+                trigger->SetEvent(level.GetString(obj.mEvent));
+                trigger->SetGroundsIds(ParseIntList(level.GetString(obj.mGrounds)));
+                trigger->SetEnemiesIds(ParseIntList(level.GetString(obj.mEnemies)));
+                trigger->SetFixedCameraPosition(Vector2(obj.mFixedCameraPositionX, obj.mFixedCameraPositionY));
+                trigger->SetScene(level.GetString(obj.mScene));
+                trigger->SetDialoguePath(level.GetString(obj.mFilePath));
+                trigger->SetCutsceneId(level.GetString(obj.mCutsceneId));
+                break;
             }
-        }
-        if (layer["name"] == "Levers") {
-            for (const auto &obj: layer["objects"]) {
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
-                float width = static_cast<float>(obj["width"]) * mScale;
-                float height = static_cast<float>(obj["height"]) * mScale;
-                std::string target;
-                std::string event;
-                std::string grounds;
-                std::string enemies;
+
+            case LevelObjectType::Lever: {
+                std::string target = level.GetString(obj.mTarget);
+                std::string grounds = level.GetString(obj.mGrounds);
                 std::vector<int> groundsIds;
                 std::vector<int> enemiesIds;
-                float fixedCameraPositionX = 0;
-                float fixedCameraPositionY = 0;
-                if (obj.contains("properties")) {
-                    for (const auto &prop: obj["properties"]) {
-                        std::string propName = prop["name"];
-                        if (propName == "Target") {
-                            target = prop["value"];
-                        }
-                        else if (propName == "Event") {
-                            event = prop["value"];
-                        }
-                        else if (propName == "Grounds") {
-                            grounds = prop["value"];
-                        }
-                        else if (propName == "Enemies") {
-                            enemies = prop["value"];
-                        }
-                        else if (propName == "FixedCameraPositionX") {
-                            fixedCameraPositionX = prop["value"];
-                        }
-                        else if (propName == "FixedCameraPositionY") {
-                            fixedCameraPositionY = prop["value"];
-                        }
-                    }
-                }
                 if ((target == "DynamicGround" || target == "Ground") && !grounds.empty()) {
                     groundsIds = ParseIntList(grounds);
                 }
                 if (target == "Enemy") {
-                    enemiesIds = ParseIntList(enemies);
+                    enemiesIds = ParseIntList(level.GetString(obj.mEnemies));
                 }
                 auto* lever = new Lever(this);
                 lever->SetPosition(Vector2(x + width / 2, y + height / 2));
                 lever->SetTarget(target);
-                lever->SetEvent(event);
+                lever->SetEvent(level.GetString(obj.mEvent));
                 lever->SetGroundsIds(groundsIds);
                 lever->SetEnemiesIds(enemiesIds);
-                lever->SetFixedCameraPosition(Vector2(fixedCameraPositionX, fixedCameraPositionY));
+                lever->SetFixedCameraPosition(Vector2(obj.mFixedCameraPositionX, obj.mFixedCameraPositionY));
+                break;
             }
-        }
-        if (layer["name"] == "Enemies") {
-            for (const auto &obj: layer["objects"]) {
-                std::string name = obj["name"];
-                int id = obj["id"];
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
-                float MinPosX = 0;
-                float MaxPosX = 0;
-                float MinPosY = 0;
-                float MaxPosY = 0;
-                std::string grounds;
-                std::vector<int> ids;
-                if (name == "Enemy Simple") {
-                    auto* enemySimple = new EnemySimple(this, 53, 45, 200, 30);
-                    enemySimple->SetPosition(Vector2(x, y));
-                    enemySimple->SetId(id);
-                }
-                else if (name == "Flying Enemy") {
-                    auto* flyingEnemySimple = new FlyingEnemySimple(this, 70, 70, 250, 60);
-                    flyingEnemySimple->SetPosition(Vector2(x, y));
-                    flyingEnemySimple->SetId(id);
-                }
-                else if (name == "FlyingShooterEnemy") {
-                    auto* flyingShooterEnemy = new FlyingShooterEnemy(this, 70, 70, 250, 70);
-                    flyingShooterEnemy->SetPosition(Vector2(x, y));
-                    flyingShooterEnemy->SetId(id);
-                }
-                else if (name == "Mantis") {
-                    auto* mantis = new Mantis(this, 120, 120, 250, 100);
-                    mantis->SetPosition(Vector2(x, y));
-                    mantis->SetId(id);
-                }
-                else if (name == "Fox") {
-                    if (obj.contains("properties")) {
-                        for (const auto &prop: obj["properties"]) {
-                            std::string propName = prop["name"];
-                            if (propName == "UnlockGrounds") {
-                                grounds = prop["value"];
-                            }
-                        }
-                    }
-                    ids = ParseIntList(grounds);
-                    auto* fox = new Fox(this, 100, 170, 300, 700);
-                    fox->SetPosition(Vector2(x, y));
-                    fox->SetId(id);
-                    fox->SetUnlockGroundsIds(ids);
-                }
-                else if (name == "Frog") {
-                    if (obj.contains("properties")) {
-                        for (const auto &prop: obj["properties"]) {
-                            std::string propName = prop["name"];
-                            if (propName == "MinPosX") {
-                                MinPosX = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MaxPosX") {
-                                MaxPosX = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MinPosY") {
-                                MinPosY =static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MaxPosY") {
-                                MaxPosY = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "UnlockGrounds") {
-                                grounds = prop["value"];
-                            }
-                        }
-                    }
-                    ids = ParseIntList(grounds);
-                    auto* frog = new Frog(this, 165, 165, 300, 500);
-                    frog->SetPosition(Vector2(x, y));
-                    frog->SetId(id);
-                    frog->SetArenaMinPos(Vector2(MinPosX, MinPosY));
-                    frog->SetArenaMaxPos(Vector2(MaxPosX, MaxPosY));
-                    frog->SetUnlockGroundsIds(ids);
-                }
-                else if (name == "Moth") {
-                    auto* moth = new Moth(this, 200, 200, 500, 1000);
-                    moth->SetPosition(Vector2(x, y));
-                    moth->SetId(id);
-                }
-                else if (name == "BushMonster") {
-                    auto* bushMonster = new BushMonster(this, 220, 140, 300, 300);
-                    bushMonster->SetPosition(Vector2(x, y));
-                    bushMonster->SetId(id);
-                }
-                else if (name == "Golem") {
-                    if (obj.contains("properties")) {
-                        for (const auto &prop: obj["properties"]) {
-                            std::string propName = prop["name"];
-                            if (propName == "MinPosX") {
-                                MinPosX = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MaxPosX") {
-                                MaxPosX = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MinPosY") {
-                                MinPosY =static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "MaxPosY") {
-                                MaxPosY = static_cast<float>(prop["value"]) * mScale;
-                            }
-                            else if (propName == "UnlockGrounds") {
-                                grounds = prop["value"];
-                            }
-                        }
-                    }
-                    auto* golem = new Golem(this, 144, 190, 600, 400);
-                    golem->SetPosition(Vector2(x, y));
-                    golem->SetId(id);
-                    golem->SetArenaMinPos(Vector2(MinPosX, MinPosY));
-                    golem->SetArenaMaxPos(Vector2(MaxPosX, MaxPosY));
-                }
+
+            case LevelObjectType::EnemySimple: {
+                auto* enemySimple = new EnemySimple(this, 53, 45, 200, 30);
+                enemySimple->SetPosition(Vector2(x, y));
+                enemySimple->SetId(id);
+                break;
+            }
+
+            case LevelObjectType::FlyingEnemy: {
+                auto* flyingEnemySimple = new FlyingEnemySimple(this, 70, 70, 250, 60);
+                flyingEnemySimple->SetPosition(Vector2(x, y));
+                flyingEnemySimple->SetId(id);
+                break;
             }
-        }
-        if (layer["name"] == "Checkpoint") {
-            for (const auto &obj: layer["objects"]) {
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
-                float width = static_cast<float>(obj["width"]) * mScale;
-                float height = static_cast<float>(obj["height"]) * mScale;
 
+            case LevelObjectType::FlyingShooterEnemy: {
+                auto* flyingShooterEnemy = new FlyingShooterEnemy(this, 70, 70, 250, 70);
+                flyingShooterEnemy->SetPosition(Vector2(x, y));
+                flyingShooterEnemy->SetId(id);
+                break;
+            }
+
+            case LevelObjectType::Mantis: {
+                auto* mantis = new Mantis(this, 120, 120, 250, 100);
+                mantis->SetPosition(Vector2(x, y));
+                mantis->SetId(id);
+                break;
+            }
+
+            case LevelObjectType::Fox: {
+                auto* fox = new Fox(this, 100, 170, 300, 700);
+                fox->SetPosition(Vector2(x, y));
+                fox->SetId(id);
+                fox->SetUnlockGroundsIds(ParseIntList(level.GetString(obj.mUnlockGrounds)));
+                break;
+            }
+
+            case LevelObjectType::Frog: {
+                auto* frog = new Frog(this, 165, 165, 300, 500);
+                frog->SetPosition(Vector2(x, y));
+                frog->SetId(id);
+                frog->SetArenaMinPos(Vector2(obj.mMinPosX, obj.mMinPosY) * mScale);
+                frog->SetArenaMaxPos(Vector2(obj.mMaxPosX, obj.mMaxPosY) * mScale);
+                frog->SetUnlockGroundsIds(ParseIntList(level.GetString(obj.mUnlockGrounds)));
+                break;
+            }
+
+            case LevelObjectType::Moth: {
+                auto* moth = new Moth(this, 200, 200, 500, 1000);
+                moth->SetPosition(Vector2(x, y));
+                moth->SetId(id);
+                break;
+            }
+
+            case LevelObjectType::BushMonster: {
+                auto* bushMonster = new BushMonster(this, 220, 140, 300, 300);
+                bushMonster->SetPosition(Vector2(x, y));
+                bushMonster->SetId(id);
+                break;
+            }
+
+            case LevelObjectType::Golem: {
+                auto* golem = new Golem(this, 144, 190, 600, 400);
+                golem->SetPosition(Vector2(x, y));
+                golem->SetId(id);
+                golem->SetArenaMinPos(Vector2(obj.mMinPosX, obj.mMinPosY) * mScale);
+                golem->SetArenaMaxPos(Vector2(obj.mMaxPosX, obj.mMaxPosY) * mScale);
+                break;
+            }
+
+            case LevelObjectType::Checkpoint: {
                 auto checkpoint = new Checkpoint(this, width, height, Vector2(x + width / 2, y + height / 2));
+                break;
             }
-        }
 
-        if (layer["name"] == "Player") {
-            for (const auto &obj: layer["objects"]) {
-                float x = static_cast<float>(obj["x"]) * mScale;
-                float y = static_cast<float>(obj["y"]) * mScale;
+            case LevelObjectType::Player: {
                 if (mPlayer) {
                     mPlayer->SetSword();
                     mPlayer->GetComponent<RigidBodyComponent>()->SetVelocity(Vector2::Zero);
@@ -1219,105 +1110,362 @@ void Game::LoadObjects(const std::string &fileName) {
                 mPlayer->SetState(ActorState::Active);
                 mPlayer->SetPosition(mCheckpointPosition);
                 mPlayer->GetComponent<AABBComponent>()->SetActive(true);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    // Grounds entram na grade na origem, antes de serem posicionados
+    for (Ground* g : mGrounds) {
+        mGroundGrid->Update(g);
+    }
+
+    mLoadingObjectId = -1;
+
+    BuildTileCollision();
+    BuildTileChunks();
+
+    // Estado inicial da fase, restaurado quando o player morre
+    mLevelSnapshot->Capture();
+}
+
+bool Game::BeginLevelObject(int id)
+{
+    if (mIsRestoringLevel && !std::binary_search(mObjectsToCreate.begin(), mObjectsToCreate.end(), id)) {
+        mLoadingObjectId = -1;
+        return false;
+    }
+    mLoadingObjectId = id;
+    return true;
+}
+
+void Game::RestoreLevelSnapshot()
+{
+    PROFILE_SCOPE("RestoreLevelSnapshot");
+    // Sem snapshot (ex.: a resolução mudou) a fase é recriada inteira a partir do json
+    if (mLevelSnapshot->IsEmpty()) {
+        LoadObjects(*mLevelFile);
+        return;
+    }
+
+    // Os atores que sobreviveram voltam ao estado inicial; só os objetos perdidos são recriados
+    mLevelSnapshot->Restore(mObjectsToCreate);
+    mIsRestoringLevel = true;
+    LoadObjects(*mLevelFile);
+    mIsRestoringLevel = false;
+    mObjectsToCreate.clear();
+}
+
+void Game::BuildTileCollision()
+{
+    mTileCollision->Reset(mLevelWidth, mLevelHeight, static_cast<float>(mTileSize));
+
+    // Só grounds parados e de tamanho fixo viram colisão estática
+    for (Ground* g : mGrounds) {
+        g->SetIsInTileCollision(false);
+        if (g->GetIsMoving() || dynamic_cast<DynamicGround*>(g)) {
+            continue;
+        }
+
+        AABBComponent* aabb = g->GetAABBComponent();
+        mTileCollision->AddRect(aabb->GetWorldMin(), aabb->GetWorldMax(), g->GetIsSpike());
+        g->SetIsInTileCollision(true);
+    }
+}
+
+void Game::BuildTileChunks()
+{
+    mTileChunks->Reset(mLevelWidth, mLevelHeight, mTileSize);
+    if (!mTileChunks->IsEnabled()) {
+        return;
+    }
+
+    // Os tiles dos grounds da colisão estática são desenhados uma vez nos chunks
+    for (Ground* g : mGrounds) {
+        auto drawGroundSprites = g->GetComponent<DrawGroundSpritesComponent>();
+        if (!drawGroundSprites) {
+            continue;
+        }
+
+        bool isBaked = g->GetIsInTileCollision() && g->GetRotation() == 0.0f;
+        drawGroundSprites->SetIsBaked(isBaked);
+        if (!isBaked) {
+            continue;
+        }
+
+        Vector2 groundPos = g->GetPosition();
+        for (const auto& pair : drawGroundSprites->GetSpriteOffsetMap()) {
+            for (const Vector2& offset : pair.second) {
+                Vector2 tilePos = groundPos + offset;
+                mTileChunks->SetTile(static_cast<int>(std::round(tilePos.x / mTileSize)),
+                                     static_cast<int>(std::round(tilePos.y / mTileSize)), pair.first);
             }
         }
     }
+
+    mTileChunks->Bake(mTileSheet, mTileSheetData);
 }
 
 void Game::LoadLevel(const std::string &fileName) {
-    // Abre arquivo json
-    std::ifstream file(fileName);
-    if (!file.is_open()) {
-        SDL_Log("Erro ao abrir o arquivo");
+    PROFILE_SCOPE("LoadLevel");
+    // Mesma fase de antes: tiles, tilesheet e objetos já estão carregados
+    if (fileName == mLoadedLevelPath) {
+        mTileSize = mLevelFile->GetTileWidth() * mScale;
+        mGroundGrid->SetCellSize(static_cast<float>(mTileSize * mGroundGridCellTiles));
+        RestoreLevelSnapshot();
         return;
     }
-    nlohmann::json mapData;
-    file >> mapData;
+    FreeLevelData();
+
+    size_t pos = fileName.rfind(".json");
+    std::string basePath = fileName.substr(0, pos);
+
+    // A fase compilada (Tools/LevelCompiler) é lida de uma vez; os json só são usados sem ela
+    // ou quando o mapa ou o tileset foram editados depois da compilação
+    mLevelFile = new LevelFile();
+    std::string compiledPath = basePath + ".level";
+    std::string tileSetPath = basePath + "TileSet.json";
+    std::error_code error;
+    bool isCompiledUpToDate = false;
+    if (std::filesystem::exists(compiledPath, error)) {
+        auto compiledTime = std::filesystem::last_write_time(compiledPath, error);
+        isCompiledUpToDate = compiledTime >= std::filesystem::last_write_time(fileName, error) &&
+                             compiledTime >= std::filesystem::last_write_time(tileSetPath, error);
+    }
+    if (!isCompiledUpToDate || !mLevelFile->Load(compiledPath)) {
+        if (!mLevelFile->LoadJson(fileName, tileSetPath)) {
+            delete mLevelFile;
+            mLevelFile = nullptr;
+            return;
+        }
+    }
 
     // Lê altura, largura e tileSize
-    int height = int(mapData["height"]);
-    int width = int(mapData["width"]);
-    int tileSize = int(mapData["tilewidth"]) * mScale;
+    int height = mLevelFile->GetHeight();
+    int width = mLevelFile->GetWidth();
+    int tileSize = mLevelFile->GetTileWidth() * mScale;
     mLevelHeight = height;
     mLevelWidth = width;
     mTileSize = tileSize;
-
-    // Lê matrizes de tiles
-    for (const auto& layer : mapData["layers"]) {
-        if (layer["name"] == "Camada de Blocos 1") {
-            std::vector<int> data = layer["data"];
-            int** matrix = new int*[height];
-            for (int i = 0; i < height; ++i) {
-                matrix[i] = new int[width];
-                for (int j = 0; j < width; ++j) {
-                    matrix[i][j] = data[i * width + j];
-                }
-            }
-            mLevelData = matrix;
-        } else if (layer["name"] == "DynamicGrounds") {
-            std::vector<int> data = layer["data"];
-            int** matrix = new int*[height];
-            for (int i = 0; i < height; ++i) {
-                matrix[i] = new int[width];
-                for (int j = 0; j < width; ++j) {
-                    matrix[i][j] = data[i * width + j];
-                }
-            }
-            mLevelDataDynamicGrounds = matrix;
+    mGroundGrid->SetCellSize(static_cast<float>(mTileSize * mGroundGridCellTiles));
+
+    // As linhas das matrizes apontam direto para os tiles da fase, sem cópia
+    int* tiles = mLevelFile->GetTiles();
+    if (tiles) {
+        mLevelData = new int*[height];
+        for (int i = 0; i < height; ++i) {
+            mLevelData[i] = tiles + i * width;
+        }
+    }
+    int* dynamicGroundTiles = mLevelFile->GetDynamicGroundTiles();
+    if (dynamicGroundTiles) {
+        mLevelDataDynamicGrounds = new int*[height];
+        for (int i = 0; i < height; ++i) {
+            mLevelDataDynamicGrounds[i] = dynamicGroundTiles + i * width;
         }
     }
 
     // Load tilesheet texture
-    size_t pos = fileName.rfind(".json");
-    std::string tileSheetTexturePath = fileName.substr(0, pos) + ".png";
-    mTileSheet = LoadTexture(tileSheetTexturePath);
+    std::string tileSheetTexturePath = basePath + ".png";
+    SDL_Rect tileSheetRegion;
+    mTileSheet = LoadTexture(tileSheetTexturePath, tileSheetRegion);
 
     // Load tilesheet data
-    std::string tileSheetDataPath = fileName.substr(0, pos) + "TileSet.json";
-    std::ifstream tileSheetFile(tileSheetDataPath);
+    const LevelTileSprite* tileSprites = mLevelFile->GetTileSprites();
+    for (int i = 0; i < mLevelFile->GetNumTileSprites(); i++) {
+        const LevelTileSprite& tile = tileSprites[i];
+        // Posição relativa à região do tilesheet no atlas
+        mTileSheetData[tile.mIndex] = SDL_Rect{tileSheetRegion.x + tile.mX, tileSheetRegion.y + tile.mY,
+                                               tile.mWidth, tile.mHeight};
+    }
 
-    nlohmann::json tileSheetData = nlohmann::json::parse(tileSheetFile);
+    mLoadedLevelPath = fileName;
+
+    // Cria objetos
+    LoadObjects(*mLevelFile);
+}
 
-    for (const auto &tile: tileSheetData["sprites"]) {
-        std::string tileFileName = tile["fileName"];
-        int x = tile["x"].get<int>();
-        int y = tile["y"].get<int>();
-        int w = tile["width"].get<int>();
-        int h = tile["height"].get<int>();
 
-        size_t dotPos = tileFileName.find('.');
-        std::string numberStr = tileFileName.substr(0, dotPos);
-        int index = std::stoi(numberStr); // converte para inteiro
+bool Game::CreateWindowAndRenderer()
+{
+    mWindow = SDL_CreateWindow("Echoes of Elementum", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                               mWindowWidth, mWindowHeight,
+                               // SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
+                               SDL_WINDOW_FULLSCREEN_DESKTOP | SDL_WINDOW_RESIZABLE);
 
-        mTileSheetData[index] = SDL_Rect{x, y, w, h};
+    if (!mWindow) {
+        SDL_Log("Failed to create window: %s", SDL_GetError());
+        return false;
     }
 
-    // Cria objetos
-    LoadObjects(fileName);
-}
+    mRenderer = SDL_CreateRenderer(mWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    if (!mRenderer) {
+        SDL_Log("Failed to create renderer: %s", SDL_GetError());
+        return false;
+    }
+
+    // Se o driver não suportar vsync, o próprio pacer limita a taxa de quadros
+    SDL_RendererInfo rendererInfo;
+    bool hasVSync = SDL_GetRendererInfo(mRenderer, &rendererInfo) == 0 &&
+                    (rendererInfo.flags & SDL_RENDERER_PRESENTVSYNC);
+    if (!hasVSync) {
+        SDL_Log("VSync indisponível, limitando a %d quadros por segundo", mFPS);
+    }
+    mFramePacer = new FramePacer(static_cast<float>(mFPS),
+                                 hasVSync ? FramePacer::Mode::VSync : FramePacer::Mode::Limit);
 
+    return true;
+}
 
 void Game::RunLoop()
 {
+    if (mIsHeadless) {
+        RunHeadlessLoop();
+        return;
+    }
+
     while (mIsRunning)
     {
-        ProcessInput();
-        UpdateGame();
+        float frameTime = mFramePacer->WaitForNextFrame();
+
+        // Evita acumular passos demais depois de um travamento
+        if (frameTime > 0.05f) {
+            frameTime = 0.05f;
+        }
+
+        // testes para alterar velocidade do jogo
+        if (mIsSlowMotion) {
+            frameTime *= 0.5;
+        }
+        if (mIsAccelerated) {
+            frameTime *= 1.5;
+        }
+
+        // Simulação avança em passos fixos, independente da taxa de renderização
+        Uint64 updateStart = SDL_GetPerformanceCounter();
+        mTimeAccumulator += frameTime;
+        while (mTimeAccumulator >= mFixedDeltaTime && mIsRunning) {
+            RunSimulationStep();
+            mTimeAccumulator -= mFixedDeltaTime;
+        }
+        mLastUpdateTime = static_cast<float>(SDL_GetPerformanceCounter() - updateStart) /
+                          static_cast<float>(SDL_GetPerformanceFrequency());
+
+        mRenderAlpha = mTimeAccumulator / mFixedDeltaTime;
         GenerateOutput();
+        PROFILE_FRAME();
+    }
+}
+
+void Game::RunHeadlessLoop()
+{
+    // Um passo fixo por iteração, sem esperar o relógio e sem desenhar
+    while (mIsRunning)
+    {
+        mFramePacer->WaitForNextFrame();
+        RunSimulationStep();
+        PROFILE_FRAME();
     }
+
+    SDL_Log("Headless: %d passos, média %.3f ms, p99 %.3f ms, máximo %.3f ms", mSimulationStep,
+            mFramePacer->GetAverageFrameTime() * 1000.0f,
+            mFramePacer->GetFrameTimePercentile(0.99f) * 1000.0f,
+            mFramePacer->GetMaxFrameTime() * 1000.0f);
+}
+
+void Game::RunSimulationStep()
+{
+    if (mInputScript) {
+        mInputScript->Apply(mSimulationStep);
+    }
+
+    ProcessInput();
+    UpdateGame(mFixedDeltaTime);
+    mSimulationStep++;
+
+    if (mMaxSimulationSteps > 0 && mSimulationStep >= mMaxSimulationSteps) {
+        mIsRunning = false;
+    }
+}
+
+bool Game::LoadInputReplay(const std::string &recordingPath)
+{
+    InputScript* inputScript = new InputScript();
+    unsigned int seed;
+    float fixedDeltaTime;
+    int numSteps;
+    if (!inputScript->LoadRecording(recordingPath, seed, fixedDeltaTime, numSteps)) {
+        delete inputScript;
+        return false;
+    }
+
+    if (Math::Abs(fixedDeltaTime - mFixedDeltaTime) > 0.000001f) {
+        SDL_Log("Gravação feita com passo de %.6f s, usando-o no lugar de %.6f s", fixedDeltaTime, mFixedDeltaTime);
+        mFixedDeltaTime = fixedDeltaTime;
+    }
+
+    delete mInputScript;
+    mInputScript = inputScript;
+    SetRandomSeed(seed);
+    if (mMaxSimulationSteps == 0) {
+        mMaxSimulationSteps = numSteps;
+    }
+    return true;
+}
+
+bool Game::StartInputRecording(const std::string &recordingPath)
+{
+    if (mInputScript) {
+        SDL_Log("Não é possível gravar a entrada enquanto um script ou replay controla o jogo");
+        return false;
+    }
+    if (mController) {
+        SDL_Log("Aviso: apenas o teclado é gravado, a entrada do controle não será reproduzida");
+    }
+
+    delete mInputRecorder;
+    mInputRecorder = new InputRecorder(recordingPath, Random::GetSeed(), mFixedDeltaTime);
+    return true;
+}
+
+bool Game::LoadInputScript(const std::string &scriptPath)
+{
+    InputScript* inputScript = new InputScript();
+    if (!inputScript->Load(scriptPath)) {
+        delete inputScript;
+        return false;
+    }
+
+    delete mInputScript;
+    mInputScript = inputScript;
+    return true;
 }
 
 void Game::ProcessInput()
 {
+    PROFILE_SCOPE("ProcessInput");
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
+        if (mInputRecorder && (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) && event.key.repeat == 0) {
+            mInputRecorder->RecordKey(mSimulationStep, event.key.keysym.scancode, event.type == SDL_KEYDOWN);
+        }
+
         switch (event.type)
         {
             case SDL_QUIT:
                 Quit();
                 break;
 
+            case SDL_RENDER_TARGETS_RESET:
+            case SDL_RENDER_DEVICE_RESET:
+                // O conteúdo dos render targets se perde, os chunks são redesenhados quando aparecerem
+                mTileChunks->Invalidate();
+                break;
+
             case SDL_WINDOWEVENT:
                 if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
                 {
@@ -1352,6 +1500,10 @@ void Game::ProcessInput()
                 break;
 
             case SDL_KEYDOWN:
+                if (event.key.keysym.sym == SDLK_F3 && event.key.repeat == 0) {
+                    TogglePerfOverlay();
+                }
+
                 if (mGamePlayState != GamePlayState::GameOver) {
                     mIsPlayingOnKeyboard = true;
                     // Handle key press for UI screens
@@ -1503,7 +1655,8 @@ void Game::ProcessInput()
         }
     }
 
-    const Uint8* state = SDL_GetKeyboardState(nullptr);
+    // Com um script de entrada o estado das teclas vem dele, não do teclado
+    const Uint8* state = mInputScript ? mInputScript->GetKeyState() : SDL_GetKeyboardState(nullptr);
 
     if (mGamePlayState == GamePlayState::Playing) {
         if (!mIsPaused) {
@@ -1517,6 +1670,28 @@ void Game::ProcessInput()
     }
 }
 
+void Game::TogglePerfOverlay() {
+    // Sem renderer não há o que mostrar
+    if (!mRenderer) {
+        return;
+    }
+
+    if (!mPerfOverlay) {
+        mPerfOverlay = new PerfOverlay(this, "../Assets/Fonts/K2D-Bold.ttf");
+        return;
+    }
+    mPerfOverlay->SetIsVisible(!mPerfOverlay->IsVisible());
+}
+
+void Game::SetVSync(bool vsync) {
+    if (SDL_RenderSetVSync(mRenderer, vsync ? 1 : 0) != 0) {
+        SDL_Log("Falha ao alterar vsync: %s", SDL_GetError());
+        vsync = false;
+    }
+    // Sem vsync o pacer volta a limitar a taxa de quadros
+    mFramePacer->SetMode(vsync ? FramePacer::Mode::VSync : FramePacer::Mode::Limit);
+}
+
 void Game::TogglePause() {
     if (mGameScene != GameScene::MainMenu &&
         mGamePlayState != GamePlayState::Cutscene)
@@ -1546,33 +1721,17 @@ void Game::TogglePause() {
 }
 
 
-void Game::UpdateGame()
+void Game::UpdateGame(float deltaTime)
 {
-    // while (!SDL_TICKS_PASSED(SDL_GetTicks(), mTicksCount + 1000.0 / mFPS));
-
-    const auto frameDuration = static_cast<Uint32>(1000.0f / mFPS);
-    Uint32 now = SDL_GetTicks();
-    if (now < mTicksCount + frameDuration)
-        SDL_Delay((mTicksCount + frameDuration) - now);
-
-    float deltaTime = static_cast<float>(SDL_GetTicks() - mTicksCount) / 1000.0f;
-    if (deltaTime > 0.05f) {
-        deltaTime = 0.05f;
-    }
-
-    mTicksCount = SDL_GetTicks();
-
-    // testes para alterar velocidade do jogo
-    if (mIsSlowMotion) {
-        deltaTime *= 0.5;
+    PROFILE_SCOPE("UpdateGame");
+    // Guarda as posições do passo anterior para interpolar o desenho
+    for (auto actor : mActors) {
+        actor->SavePreviousPosition();
     }
-    if (mIsAccelerated) {
-        deltaTime *= 1.5;
+    if (mCamera) {
+        mCamera->SavePreviousPosition();
     }
 
-    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255); // Usado para deixar as bordas em preto
-    SDL_RenderClear(mRenderer);
-
     // Update all actors and pending actors
     if (!mIsPaused) {
         if (mHitstopDelayActive) {
@@ -1625,10 +1784,14 @@ void Game::UpdateGame()
         }
     }
 
-    mAudio->Update(deltaTime);
+    {
+        PROFILE_SCOPE("UpdateAudio");
+        mAudio->Update(deltaTime);
+    }
 
     // Reinsert UI screens
     for (auto ui : mUIStack) {
+        PROFILE_SCOPE("UpdateUI");
         // if (ui != mHUD) {
             if (ui->GetState() == UIScreen::UIState::Active) {
                 ui->Update(deltaTime);
@@ -1721,12 +1884,28 @@ void Game::UpdateSceneManager(float deltaTime)
 
 void Game::UpdateActors(float deltaTime)
 {
+    PROFILE_SCOPE("UpdateActors");
+
+    // Corpos rígidos de todos os atores ativos de uma vez, antes dos outros componentes
+    {
+        PROFILE_SCOPE("IntegrateRigidBodies");
+        mRigidBodies->Integrate(deltaTime);
+    }
+
     mUpdatingActors = true;
-    for (auto actor: mActors)
+    for (auto actor: mActors) {
+        PROFILE_SCOPE(typeid(*actor).name());
         actor->Update(deltaTime);
+    }
 
     mUpdatingActors = false;
 
+    // Partículas emitidas pelos atores neste passo já se movem nele
+    {
+        PROFILE_SCOPE("UpdateParticles");
+        mParticles->Update(deltaTime);
+    }
+
     for (auto pending: mPendingActors)
         mActors.emplace_back(pending);
 
@@ -1742,64 +1921,100 @@ void Game::UpdateActors(float deltaTime)
 }
 
 void Game::UpdateCamera(float deltaTime) {
+    PROFILE_SCOPE("UpdateCamera");
     if (!mCamera) {
         return;
     }
     mCamera->Update(deltaTime);
 }
 
-void Game::AddGround(class Ground* g) { mGrounds.emplace_back(g); }
+void Game::AddGround(class Ground* g)
+{
+    mGrounds.emplace_back(g);
+    mGroundGrid->Insert(g);
+}
 
 void Game::RemoveGround(class Ground* g)
 {
     auto iter = std::find(mGrounds.begin(), mGrounds.end(), g);
     if (iter != mGrounds.end())
         mGrounds.erase(iter);
+
+    if (mGroundGrid) {
+        mGroundGrid->Remove(g);
+    }
+
+    if (g->GetIsInTileCollision()) {
+        RemoveGroundFromTileCollision(g);
+    }
 }
 
-Ground* Game::GetGroundById(int id) {
-    for (Ground* g : mGrounds) {
-        if (g->GetId() == id) {
-            return g;
+bool Game::CollidesWithGround(class AABBComponent* aabb)
+{
+    if (!aabb->IsActive()) {
+        return false;
+    }
+
+    Vector2 min = aabb->GetWorldMin();
+    Vector2 max = aabb->GetWorldMax();
+    if (mTileCollision->Overlaps(min, max)) {
+        return true;
+    }
+
+    // No modo contínuo também testa o caminho percorrido no frame
+    if (aabb->GetCollisionMode() == CollisionMode::Swept) {
+        Vector2 displacement = aabb->GetLastDisplacement();
+        float toi;
+        Vector2 normal;
+        if (mTileCollision->Sweep(min - displacement, max - displacement, displacement, toi, normal)) {
+            return true;
         }
     }
-    return nullptr;
-}
 
-void Game::AddFireBall(class FireBall* f) { mFireBalls.emplace_back(f); }
+    // Grounds que se movem ou mudam de tamanho ficam fora da camada de tiles
+    std::vector<Ground*> grounds;
+    QueryGrounds(aabb->GetSweptMin(), aabb->GetSweptMax(), grounds);
+    for (Ground* g : grounds) {
+        if (!g->GetIsInTileCollision() && aabb->IntersectSwept(*g->GetAABBComponent())) {
+            return true;
+        }
+    }
+    return false;
+}
 
-void Game::RemoveFireball(class FireBall* f)
+void Game::RemoveGroundFromTileCollision(class Ground* g)
 {
-    auto iter = std::find(mFireBalls.begin(), mFireBalls.end(), f);
-    if (iter != mFireBalls.end())
-        mFireBalls.erase(iter);
-}
+    AABBComponent* aabb = g->GetAABBComponent();
+    mTileCollision->RemoveRect(aabb->GetWorldMin(), aabb->GetWorldMax(), g->GetIsSpike());
+    g->SetIsInTileCollision(false);
 
-void Game::AddParticle(class Particle* p) { mParticles.emplace_back(p); }
+    // Tira os tiles do chunk e o ground volta a desenhar os próprios tiles
+    auto drawGroundSprites = g->GetComponent<DrawGroundSpritesComponent>();
+    if (drawGroundSprites && drawGroundSprites->GetIsBaked()) {
+        mTileChunks->ClearRect(aabb->GetWorldMin(), aabb->GetWorldMax());
+        drawGroundSprites->SetIsBaked(false);
+    }
+}
 
-void Game::RemoveParticle(class Particle* p)
+void Game::QueryGrounds(const Vector2& min, const Vector2& max, std::vector<class Ground*> &grounds)
 {
-    auto iter = std::find(mParticles.begin(), mParticles.end(), p);
-    if (iter != mParticles.end())
-        mParticles.erase(iter);
+    // Margem de um tile cobre grounds que se moveram desde a última atualização da grade
+    Vector2 margin(static_cast<float>(mTileSize), static_cast<float>(mTileSize));
+    mGroundGrid->Query(min - margin, max + margin, grounds);
 }
 
-void Game::AddProjectile(class Projectile* p) { mProjectiles.emplace_back(p); }
-
-void Game::RemoveProjectile(class Projectile* p)
+void Game::RefreshGround(class Ground* g)
 {
-    auto iter = std::find(mProjectiles.begin(), mProjectiles.end(), p);
-    if (iter != mProjectiles.end())
-        mProjectiles.erase(iter);
+    mGroundGrid->Update(g);
 }
 
-void Game::AddMoney(class Money* m) { mMoneys.emplace_back(m); }
-
-void Game::RemoveMoney(class Money* m)
-{
-    auto iter = std::find(mMoneys.begin(), mMoneys.end(), m);
-    if (iter != mMoneys.end())
-        mMoneys.erase(iter);
+Ground* Game::GetGroundById(int id) {
+    for (Ground* g : mGrounds) {
+        if (g->GetId() == id) {
+            return g;
+        }
+    }
+    return nullptr;
 }
 
 void Game::AddEnemy(class Enemy* e) { mEnemies.emplace_back(e); }
@@ -1822,6 +2037,9 @@ Enemy* Game::GetEnemyById(int id) {
 
 void Game::AddActor(Actor* actor)
 {
+    if (mLoadingObjectId >= 0)
+        mLevelSnapshot->AddActor(actor, mLoadingObjectId);
+
     if (mUpdatingActors)
         mPendingActors.emplace_back(actor);
 
@@ -1831,6 +2049,8 @@ void Game::AddActor(Actor* actor)
 
 void Game::RemoveActor(Actor* actor)
 {
+    mLevelSnapshot->RemoveActor(actor);
+
     auto iter = std::find(mPendingActors.begin(), mPendingActors.end(), actor);
     if (iter != mPendingActors.end())
     {
@@ -1850,18 +2070,12 @@ void Game::RemoveActor(Actor* actor)
 
 void Game::AddDrawable(class DrawComponent* drawable)
 {
-    mDrawables.emplace_back(drawable);
-
-    std::sort(mDrawables.begin(), mDrawables.end(), [](const DrawComponent* a, const DrawComponent* b)
-    {
-        return a->GetDrawOrder() < b->GetDrawOrder();
-    });
+    mDrawList.Add(drawable);
 }
 
 void Game::RemoveDrawable(class DrawComponent* drawable)
 {
-    auto iter = std::find(mDrawables.begin(), mDrawables.end(), drawable);
-    mDrawables.erase(iter);
+    mDrawList.Remove(drawable);
 }
 
 void Game::StartBossMusic(SoundHandle music) {
@@ -1903,9 +2117,38 @@ void Game::PlayFinalEvilCutscene() {
 }
 
 
+void Game::FlushSpriteBatch()
+{
+    CountDrawCalls(mSpriteBatch->Flush());
+}
+
+void Game::DrawTileChunks()
+{
+    PROFILE_SCOPE("DrawTileChunks");
+    FlushSpriteBatch();
+    int numChunks = mTileChunks->Draw(mCamera->GetRenderPosCamera(), mLogicalWindowWidth, mLogicalWindowHeight,
+                                      mTileSheet, mTileSheetData);
+    CountDrawCalls(numChunks);
+}
+
+void Game::DrawParticles()
+{
+    PROFILE_SCOPE("DrawParticles");
+    // Entram no lote da camada delas, junto com os drawables da mesma ordem
+    CountDrawCalls(mSpriteBatch->SetLayer(PARTICLES_DRAW_ORDER));
+    mParticles->Draw(mSpriteBatch, mCamera->GetRenderPosCamera(), mLogicalWindowWidth, mLogicalWindowHeight);
+}
+
 void Game::GenerateOutput()
 {
+    PROFILE_SCOPE("GenerateOutput");
+
+    Uint64 drawStart = SDL_GetPerformanceCounter();
+    mLastDrawCalls = mDrawCalls;
+    mDrawCalls = 0;
+
     // Clear back buffer
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255); // Usado para deixar as bordas em preto
     SDL_RenderClear(mRenderer);
 
     if (mCamera) {
@@ -1958,12 +2201,48 @@ void Game::GenerateOutput()
         SDL_RenderCopy(mRenderer, mBackGroundTexture, nullptr, &dest);
     }
 
-    for (auto drawable: mDrawables)
-        drawable->Draw(mRenderer);
+    // Descarta os drawables que estão fora da tela
+    SDL_Rect view = {0, 0, static_cast<int>(mLogicalWindowWidth), static_cast<int>(mLogicalWindowHeight)};
+    SDL_Rect bounds;
+    bool drewTileChunks = !mCamera;
+    bool drewParticles = !mCamera;
+    for (const DrawList::Bucket& bucket : mDrawList.GetBuckets()) {
+        // Chunks de tiles entram na ordem dos grounds
+        if (!drewTileChunks && bucket.mDrawOrder >= TILE_CHUNKS_DRAW_ORDER) {
+            DrawTileChunks();
+            drewTileChunks = true;
+        }
+        if (!drewParticles && bucket.mDrawOrder > PARTICLES_DRAW_ORDER) {
+            DrawParticles();
+            drewParticles = true;
+        }
+
+        CountDrawCalls(mSpriteBatch->SetLayer(bucket.mDrawOrder));
+        for (auto drawable : bucket.mDrawables) {
+            if (!drawable->IsVisible()) {
+                continue;
+            }
+            if (mCamera && drawable->GetScreenBounds(bounds) && !SDL_HasIntersection(&bounds, &view)) {
+                continue;
+            }
+
+            PROFILE_SCOPE(typeid(*drawable).name());
+            drawable->Draw(mRenderer);
+        }
+    }
+
+    if (!drewTileChunks) {
+        DrawTileChunks();
+    }
+    if (!drewParticles) {
+        DrawParticles();
+    }
+    FlushSpriteBatch();
 
     // Draw all UI screens
     for (auto ui :mUIStack)
     {
+        PROFILE_SCOPE("DrawUI");
         ui->Draw(mRenderer);
     }
 
@@ -1990,28 +2269,61 @@ void Game::GenerateOutput()
         SDL_RenderFillRect(mRenderer, &fullScreenRect);
     }
 
+    if (mPerfOverlay) {
+        mPerfOverlay->Update(mFramePacer->GetLastFrameTime());
+        mPerfOverlay->Draw(mRenderer);
+    }
+
     // Swap front buffer and back buffer
+    PROFILE_SCOPE("Present");
+    Uint64 presentStart = SDL_GetPerformanceCounter();
     SDL_RenderPresent(mRenderer);
+
+    float frequency = static_cast<float>(SDL_GetPerformanceFrequency());
+    mLastDrawTime = static_cast<float>(presentStart - drawStart) / frequency;
+    mLastPresentTime = static_cast<float>(SDL_GetPerformanceCounter() - presentStart) / frequency;
 }
 
 SDL_Texture* Game::LoadTexture(const std::string &texturePath)
 {
-    SDL_Surface* surface = IMG_Load(texturePath.c_str());
-    if (!surface)
-    {
-        SDL_Log("Falha ao carregar imagem %s: %s", texturePath.c_str(), IMG_GetError());
+    // Em modo headless não há renderer para criar texturas
+    if (!mRenderer) {
         return nullptr;
     }
+    return mTextureCache->Acquire(texturePath);
+}
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(mRenderer, surface);
-    SDL_FreeSurface(surface); // Libera a superfície, já não é mais necessária
-
-    if (!texture)
-    {
-        SDL_Log("Falha ao criar textura a partir de %s: %s", texturePath.c_str(), SDL_GetError());
+SDL_Texture* Game::LoadTexture(const std::string &texturePath, SDL_Rect &region)
+{
+    region = SDL_Rect{0, 0, 0, 0};
+    if (!mRenderer) {
         return nullptr;
     }
-    return texture;
+    return mTextureCache->AcquireRegion(texturePath, region);
+}
+
+void Game::ReleaseTexture(SDL_Texture *texture)
+{
+    if (mTextureCache) {
+        mTextureCache->Release(texture);
+    }
+}
+
+SpriteSheetAsset* Game::LoadSpriteSheet(const std::string &dataPath)
+{
+    auto iter = mSpriteSheets.find(dataPath);
+    if (iter != mSpriteSheets.end()) {
+        return iter->second;
+    }
+
+    // Sprite sheet ainda não carregado
+    SpriteSheetAsset* spriteSheet = new SpriteSheetAsset();
+    if (!spriteSheet->Load(dataPath)) {
+        // Mantém o asset vazio no cache para não tentar ler o arquivo de novo
+        SDL_Log("Falha ao carregar sprite sheet: %s", dataPath.c_str());
+    }
+    mSpriteSheets.emplace(dataPath, spriteSheet);
+    return spriteSheet;
 }
 
 UIFont* Game::LoadFont(const std::string& fileName)
@@ -2036,7 +2348,7 @@ UIFont* Game::LoadFont(const std::string& fileName)
     }
 }
 
-void Game::UnloadScene()
+void Game::UnloadScene(bool keepLevelData)
 {
     if (mGamePlayState != GamePlayState::Cutscene) {
         mGamePlayState = GamePlayState::GameOver;
@@ -2046,9 +2358,28 @@ void Game::UnloadScene()
         mPlayer->SetState(ActorState::Paused);
     }
 
+    // Objetos dos pools em uso voltam para os pools em vez de serem deletados
+    for (FireBall* f : mFireBallPool.GetObjects()) {
+        if (f->GetIsInUse()) {
+            f->Deactivate();
+        }
+    }
+    for (Projectile* p : mProjectilePool.GetObjects()) {
+        if (p->GetIsInUse()) {
+            p->Deactivate();
+        }
+    }
+    for (Money* m : mMoneyPool.GetObjects()) {
+        if (m->GetIsInUse()) {
+            m->Deactivate();
+        }
+    }
+
     for (auto it = mActors.begin(); it != mActors.end(); ) {
         Actor* actor = *it;
-        if (actor != mPlayer) {
+        // Atores da fase que estão no snapshot sobrevivem a um reset e só têm o estado restaurado
+        bool isInSnapshot = keepLevelData && actor->GetIsInLevelSnapshot();
+        if (actor != mPlayer && !actor->GetIsPersistent() && !isInSnapshot) {
             it = mActors.erase(it);
             delete actor;
         } else {
@@ -2063,31 +2394,17 @@ void Game::UnloadScene()
     mUIStack.clear();
     mHUD = nullptr;
 
-    // Delete level data
-    if (mLevelData != nullptr) {
-        for (int i = 0; i < mLevelHeight; ++i) {
-            if (mLevelData[i] != nullptr)
-                delete[] mLevelData[i];
-        }
+    if (!keepLevelData) {
+        FreeLevelData();
     }
-    delete[] mLevelData;
-    mLevelData = nullptr;
 
-    // Delete level data Dynamic Grounds
-    if (mLevelDataDynamicGrounds != nullptr) {
-        for (int i = 0; i < mLevelHeight; ++i) {
-            if (mLevelDataDynamicGrounds[i] != nullptr)
-                delete[] mLevelDataDynamicGrounds[i];
-        }
-    }
-    delete[] mLevelDataDynamicGrounds;
-    mLevelDataDynamicGrounds = nullptr;
+    // Libera as texturas dos chunks
+    mTileChunks->Reset(0, 0, mTileSize);
 
-    SDL_DestroyTexture(mTileSheet);
-    mTileSheet = nullptr;
+    mParticles->Clear();
 
     if (mBackGroundTexture) {
-        SDL_DestroyTexture(mBackGroundTexture);
+        ReleaseTexture(mBackGroundTexture);
         mBackGroundTexture = nullptr;
     }
 
@@ -2095,6 +2412,24 @@ void Game::UnloadScene()
     mCamera = nullptr;
 }
 
+void Game::FreeLevelData()
+{
+    // As linhas apontam para os tiles do mLevelFile, só o array de linhas é da Game
+    delete[] mLevelData;
+    mLevelData = nullptr;
+    delete[] mLevelDataDynamicGrounds;
+    mLevelDataDynamicGrounds = nullptr;
+
+    ReleaseTexture(mTileSheet);
+    mTileSheet = nullptr;
+    mTileSheetData.clear();
+
+    mLevelSnapshot->Clear();
+    mLoadedLevelPath.clear();
+    delete mLevelFile;
+    mLevelFile = nullptr;
+}
+
 void Game::Shutdown()
 {
     delete mPlayer;
@@ -2103,6 +2438,24 @@ void Game::Shutdown()
     mStore = nullptr;
     UnloadScene();
 
+    // Atores dos pools vivem a sessão inteira
+    while (!mActors.empty()) {
+        delete mActors.back();
+    }
+    mFireBallPool.Clear();
+    mProjectilePool.Clear();
+    mMoneyPool.Clear();
+
+    delete mPerfOverlay;
+    mPerfOverlay = nullptr;
+
+    // Antes do cache, já que devolve a textura das partículas
+    delete mParticles;
+    mParticles = nullptr;
+
+    delete mLevelSnapshot;
+    mLevelSnapshot = nullptr;
+
     for (auto font : mFonts) {
         font.second->Unload();
         delete font.second;
@@ -2114,18 +2467,23 @@ void Game::Shutdown()
 
     mFonts.clear();
 
+    for (auto spriteSheet : mSpriteSheets) {
+        delete spriteSheet.second;
+    }
+    mSpriteSheets.clear();
+
     // Destroi textures
     if (mBackGroundTextureMainMenu) {
-        SDL_DestroyTexture(mBackGroundTextureMainMenu);
+        ReleaseTexture(mBackGroundTextureMainMenu);
         mBackGroundTextureMainMenu = nullptr;
     }
     if (mBackGroundTextureLevel1) {
-        SDL_DestroyTexture(mBackGroundTextureLevel1);
+        ReleaseTexture(mBackGroundTextureLevel1);
         mBackGroundTextureLevel1 = nullptr;
     }
     for (SDL_Texture*& t : mBackgroundLayersLevel2) {
         if (t) {
-            SDL_DestroyTexture(t);
+            ReleaseTexture(t);
             t = nullptr;
         }
     }
@@ -2133,7 +2491,7 @@ void Game::Shutdown()
 
     for (SDL_Texture*& t : mBackgroundLayersLevel3) {
         if (t) {
-            SDL_DestroyTexture(t);
+            ReleaseTexture(t);
             t = nullptr;
         }
     }
@@ -2141,21 +2499,57 @@ void Game::Shutdown()
 
     for (SDL_Texture*& t : mBackgroundLayersLevel4) {
         if (t) {
-            SDL_DestroyTexture(t);
+            ReleaseTexture(t);
             t = nullptr;
         }
     }
     mBackgroundLayersLevel4.clear();
 
     if (mBackGroundTextureLevel3) {
-        SDL_DestroyTexture(mBackGroundTextureLevel3);
+        ReleaseTexture(mBackGroundTextureLevel3);
         mBackGroundTextureLevel3 = nullptr;
     }
     if (mBackGroundTextureLevel4) {
-        SDL_DestroyTexture(mBackGroundTextureLevel4);
+        ReleaseTexture(mBackGroundTextureLevel4);
         mBackGroundTextureLevel4 = nullptr;
     }
 
+    // Libera todas as texturas que ainda estão no cache
+    delete mTextureCache;
+    mTextureCache = nullptr;
+
+    delete mGroundGrid;
+    mGroundGrid = nullptr;
+
+    delete mRigidBodies;
+    mRigidBodies = nullptr;
+
+    delete mTileCollision;
+    mTileCollision = nullptr;
+
+    delete mTileChunks;
+    mTileChunks = nullptr;
+
+    delete mSpriteBatch;
+    mSpriteBatch = nullptr;
+
+    delete mFramePacer;
+    mFramePacer = nullptr;
+
+#ifdef ENABLE_PROFILER
+    Profiler::LogSummary();
+    Profiler::ExportChromeTrace("profile_trace.json");
+#endif
+
+    delete mInputScript;
+    mInputScript = nullptr;
+
+    if (mInputRecorder) {
+        mInputRecorder->Save(mSimulationStep);
+        delete mInputRecorder;
+        mInputRecorder = nullptr;
+    }
+
     // Destroi audio
     delete mAudio;
     mAudio = nullptr;
@@ -2180,7 +2574,7 @@ void Game::DrawParallaxBackground(SDL_Texture* background)
     bgWidth *= mScale;
     bgHeight *= mScale;
     // Calcula o offset horizontal com base na câmera
-    int offsetX = static_cast<int>(mCamera->GetPosCamera().x * parallaxFactor) % bgWidth;
+    int offsetX = static_cast<int>(mCamera->GetRenderPosCamera().x * parallaxFactor) % bgWidth;
     if (offsetX < 0) offsetX += bgWidth;
 
     // Desenha blocos horizontais suficientes para cobrir a largura da janela
@@ -2204,7 +2598,7 @@ void Game::DrawParallaxLayer(SDL_Texture* texture, float parallaxFactor, int y,
     texW *= mScale;
     texH *= mScale;
 
-    int offsetX = static_cast<int>(mCamera->GetPosCamera().x * parallaxFactor) % texW;
+    int offsetX = static_cast<int>(mCamera->GetRenderPosCamera().x * parallaxFactor) % texW;
     if (offsetX < 0) offsetX += texW;
 
     for (int x = -offsetX; x < mLogicalWindowWidth; x += texW)
@@ -2258,10 +2652,28 @@ void Game::ChangeResolution(float oldScale)
         actor->ChangeResolution(oldScale, mScale);
     }
 
+    mGroundGrid->SetCellSize(static_cast<float>(mTileSize * mGroundGridCellTiles));
+    for (Ground* g : mGrounds) {
+        mGroundGrid->Update(g);
+    }
+    if (!mGrounds.empty()) {
+        BuildTileCollision();
+        BuildTileChunks();
+    }
+
+    mParticles->ChangeResolution(oldScale, mScale);
+
+    // O snapshot guarda posições na escala antiga: o próximo reset recria a fase inteira
+    mLevelSnapshot->Clear();
+
     if (mCamera) {
         mCamera->ChangeResolution(oldScale, mScale);
     }
 
+    if (mPerfOverlay) {
+        mPerfOverlay->ChangeResolution(oldScale, mScale);
+    }
+
     for (auto UIScreen : mUIStack) {
         UIScreen->ChangeResolution(oldScale, mScale);
     }
@@ -15,12 +15,18 @@
 #include "AudioSystem.h"
 #include "Cutscene.h"
 #include "Store.h"
+#include "DrawList.h"
+#include "ObjectPool.h"
 
 class Game
 {
 public:
     const int DEAD_ZONE = 8000;
     const float mTransitionTime = 0.2f;
+    // Draw order of the ground tiles, where the baked tile chunks are drawn
+    const int TILE_CHUNKS_DRAW_ORDER = 100;
+    // Draw order of the particles of the ParticleEngine
+    const int PARTICLES_DRAW_ORDER = 5000;
 
     // Estados de movimento do analógico vertical
     enum class StickState {
@@ -59,6 +65,23 @@ public:
 
     Game(int windowWidth, int windowHeight, int FPS);
 
+    // Headless runs create no window, renderer or audio device and simulate as fast as possible.
+    // Must be set before Initialize
+    void SetHeadless(bool headless) { mIsHeadless = headless; }
+    bool IsHeadless() const { return mIsHeadless; }
+    // Replaces keyboard input with the key changes of a script file (see InputScript)
+    bool LoadInputScript(const std::string &scriptPath);
+    // Replays a recording made with StartInputRecording, with its seed and step length.
+    // Must be called before Initialize
+    bool LoadInputReplay(const std::string &recordingPath);
+    // Records keyboard input until Shutdown, when the recording is saved. Call after Initialize
+    bool StartInputRecording(const std::string &recordingPath);
+    // Seeds Random with a fixed value instead of a random one. Must be set before Initialize
+    void SetRandomSeed(unsigned int seed) { mRandomSeed = seed; mHasRandomSeed = true; }
+    // Stops the game loop after this many simulation steps (0 runs until quit)
+    void SetMaxSimulationSteps(int steps) { mMaxSimulationSteps = steps; }
+    int GetSimulationStep() const { return mSimulationStep; }
+
     bool Initialize();
     void RunLoop();
     void Shutdown();
@@ -86,27 +109,44 @@ public:
     void RemoveGround(class Ground *g);
     std::vector<class Ground *> &GetGrounds() { return mGrounds; }
     Ground* GetGroundById(int id);
+    // Appends to grounds only the Grounds near the box (min, max), using the ground grid
+    void QueryGrounds(const Vector2& min, const Vector2& max, std::vector<class Ground *> &grounds);
+    // Must be called when a Ground moves or changes size
+    void RefreshGround(class Ground *g);
+    // Static grounds rasterized into the tile grid
+    class TileCollisionLayer* GetTileCollision() const { return mTileCollision; }
+    void RemoveGroundFromTileCollision(class Ground *g);
+    // Static ground tiles pre-rendered into chunk textures
+    class TileChunkLayer* GetTileChunks() const { return mTileChunks; }
+    // Whether the box touches any ground: static ones through the tile layer, the rest through the ground grid
+    bool CollidesWithGround(class AABBComponent *aabb);
+
+    // State of every RigidBodyComponent, integrated in one pass per step
+    class RigidBodySystem* GetRigidBodies() const { return mRigidBodies; }
 
     class Player* GetPlayer() const { return mPlayer; }
 
     void UpdateCamera(float deltaTime);
     class Camera* GetCamera() const { return mCamera; }
 
-    void AddFireBall(class FireBall *f);
-    void RemoveFireball(class FireBall *f);
-    std::vector<class FireBall*> &GetFireBalls() { return mFireBalls; }
+    // Pooled actors: acquire them from their pool instead of creating new ones.
+    // The Get*s functions list every pooled object, in use or not
+    ObjectPool<class FireBall>& GetFireBallPool() { return mFireBallPool; }
+    const std::vector<class FireBall*> &GetFireBalls() const { return mFireBallPool.GetObjects(); }
+
+    // Particles are not actors; effects emit them straight into the engine
+    class ParticleEngine* GetParticles() const { return mParticles; }
 
-    void AddParticle(class Particle *p);
-    void RemoveParticle(class Particle *p);
-    std::vector<class Particle*> &GetParticles() { return mParticles; }
+    // State of the level's actors as they were when it finished loading, restored on respawn
+    class LevelSnapshot* GetLevelSnapshot() const { return mLevelSnapshot; }
 
-    void AddProjectile(class Projectile *p);
-    void RemoveProjectile(class Projectile *p);
-    std::vector<class Projectile *> &GetProjectiles() { return mProjectiles; }
+    // One sub-pool per Projectile::ProjectileType
+    ObjectPool<class Projectile>& GetProjectilePool() { return mProjectilePool; }
+    const std::vector<class Projectile *> &GetProjectiles() const { return mProjectilePool.GetObjects(); }
 
-    void AddMoney(class Money *m);
-    void RemoveMoney(class Money *m);
-    std::vector<class Money*> &GetMoneys() { return mMoneys; }
+    // One sub-pool per Money::MoneyType
+    ObjectPool<class Money>& GetMoneyPool() { return mMoneyPool; }
+    const std::vector<class Money*> &GetMoneys() const { return mMoneyPool.GetObjects(); }
 
     void AddEnemy(class Enemy *e);
     void RemoveEnemy(class Enemy *e);
@@ -118,15 +158,40 @@ public:
     int **GetLevelData() const { return mLevelData; }
     int **GetLevelDataDynamicGrounds() const { return mLevelDataDynamicGrounds; }
     SDL_Texture* GetTileSheet() const { return mTileSheet; }
-    std::unordered_map<int, SDL_Rect> GetTileSheetData() { return mTileSheetData; }
+    const std::unordered_map<int, SDL_Rect>& GetTileSheetData() const { return mTileSheetData; }
 
     int GetTileSize() const { return mTileSize; }
 
     // Loading functions
     class UIFont* LoadFont(const std::string& fileName);
     SDL_Texture *LoadTexture(const std::string &texturePath);
+    // May return a shared atlas page; region receives the image area inside the texture
+    SDL_Texture *LoadTexture(const std::string &texturePath, SDL_Rect &region);
+    void ReleaseTexture(SDL_Texture *texture);
+    class SpriteSheetAsset* LoadSpriteSheet(const std::string &dataPath);
 
     int GetFPS() const { return mFPS; }
+    // Fraction of a simulation step elapsed since the last update, used to interpolate drawing
+    float GetRenderAlpha() const { return mRenderAlpha; }
+    class FramePacer* GetFramePacer() const { return mFramePacer; }
+    class TextureCache* GetTextureCache() const { return mTextureCache; }
+    // Sprites drawn by the draw components are batched; anything drawn directly
+    // with the renderer in between must flush the batch first
+    class SpriteBatch* GetSpriteBatch() const { return mSpriteBatch; }
+    void FlushSpriteBatch();
+
+    // Performance counters shown by the PerfOverlay
+    void CountDrawCalls(int count = 1) { mDrawCalls += count; }
+    int GetLastDrawCalls() const { return mLastDrawCalls; }
+    // Seconds spent in the last frame simulating, issuing draws and presenting
+    float GetLastUpdateTime() const { return mLastUpdateTime; }
+    float GetLastDrawTime() const { return mLastDrawTime; }
+    float GetLastPresentTime() const { return mLastPresentTime; }
+    int GetNumActors() const { return static_cast<int>(mActors.size()); }
+    int GetNumDrawables() const { return mDrawList.GetSize(); }
+    void TogglePerfOverlay();
+    // Turns vsync on or off; without it the frame pacer limits the frame rate itself
+    void SetVSync(bool vsync);
 
     void ActiveHitStop()
     {
@@ -154,7 +219,10 @@ public:
     // Scene management
     void SetGameScene(GameScene scene, float transitionTime = .0f);
     void ResetGameScene(float transitionTime = .0f);
-    void UnloadScene();
+    // keepLevelData keeps the tiles, tile sheet and parsed json of the level, used when
+    // the same level is loaded again, along with the actors of its LevelSnapshot.
+    // Pooled actors are never deleted here
+    void UnloadScene(bool keepLevelData = false);
     GameScene GetGameScene() const { return mGameScene; }
 
     void TogglePause();
@@ -186,12 +254,23 @@ public:
 
 private:
     void ProcessInput();
-    void UpdateGame();
+    void UpdateGame(float deltaTime);
+    bool CreateWindowAndRenderer();
+    void RunHeadlessLoop();
+    void RunSimulationStep();
     void GenerateOutput();
 
     // Load Level
-    void LoadObjects(const std::string &fileName);
+    void LoadObjects(const class LevelFile &level);
     void LoadLevel(const std::string &fileName);
+    void FreeLevelData();
+    // Starts creating the actors of a level object; false if the object must be skipped
+    // (when only the objects missing from the snapshot are being created)
+    bool BeginLevelObject(int id);
+    // Loads the snapshot back into the level's actors and creates the missing objects
+    void RestoreLevelSnapshot();
+    void BuildTileCollision();
+    void BuildTileChunks();
     void LoadMainMenu();
     UIScreen* LoadPauseMenu();
     void LoadLevelSelectMenu();
@@ -206,12 +285,15 @@ private:
     std::vector<class Actor *> mPendingActors;
 
     // All the draw components
-    std::vector<class DrawComponent *> mDrawables;
+    DrawList mDrawList;
 
     // SDL stuff
     SDL_Window *mWindow;
     SDL_Renderer *mRenderer;
     AudioSystem* mAudio;
+    class TextureCache* mTextureCache;
+    // Written by the atlas-packer target; without it the images are loaded separately
+    const std::string mAtlasManifestPath = "../Assets/Atlas/Atlas.json";
 
     // Window properties
     int mWindowWidth;
@@ -221,14 +303,35 @@ private:
     float mLogicalWindowWidth;
     float mLogicalWindowHeight;
 
-    // Track elapsed time since game start
-    Uint32 mTicksCount;
+    // Measures frame time and limits the frame rate when vsync is off
+    class FramePacer* mFramePacer;
+
+    class SpriteBatch* mSpriteBatch;
+
+    class PerfOverlay* mPerfOverlay;
+    int mDrawCalls;
+    int mLastDrawCalls;
+    float mLastUpdateTime;
+    float mLastDrawTime;
+    float mLastPresentTime;
+
+    bool mIsHeadless;
+    class InputScript* mInputScript;
+    class InputRecorder* mInputRecorder;
+    bool mHasRandomSeed;
+    unsigned int mRandomSeed;
+    int mSimulationStep;
+    int mMaxSimulationSteps;
 
     // Track if we're updating actors right now
     bool mIsRunning;
     bool mUpdatingActors;
 
+    // Simulation runs in fixed steps of 1 / mFPS seconds; rendering runs once per loop iteration
     int mFPS;
+    float mFixedDeltaTime;
+    float mTimeAccumulator;
+    float mRenderAlpha;
 
     bool mIsPaused;
     bool mResetLevel;
@@ -239,10 +342,20 @@ private:
     // Game-specific
     class Player *mPlayer;
     std::vector<class Ground*> mGrounds;
-    std::vector<class FireBall*> mFireBalls;
-    std::vector<class Particle*> mParticles;
-    std::vector<class Projectile*> mProjectiles;
-    std::vector<class Money*> mMoneys;
+    class GroundGrid* mGroundGrid;
+    class RigidBodySystem* mRigidBodies;
+    class TileCollisionLayer* mTileCollision;
+    class TileChunkLayer* mTileChunks;
+    class ParticleEngine* mParticles;
+    class LevelSnapshot* mLevelSnapshot;
+    // Tiled id of the object whose actors are being created (-1 outside LoadObjects)
+    int mLoadingObjectId;
+    // Sorted ids of the only objects LoadObjects creates during RestoreLevelSnapshot
+    std::vector<int> mObjectsToCreate;
+    bool mIsRestoringLevel;
+    ObjectPool<class FireBall> mFireBallPool;
+    ObjectPool<class Projectile> mProjectilePool;
+    ObjectPool<class Money> mMoneyPool;
     std::vector<class Enemy *> mEnemies;
     SDL_GameController *mController;
     class HUD *mHUD;
@@ -260,10 +373,15 @@ private:
     int **mLevelDataDynamicGrounds;
     SDL_Texture* mTileSheet;
     std::unordered_map<int, SDL_Rect> mTileSheetData;
+    // Level whose data is loaded, kept across resets of the same level
+    std::string mLoadedLevelPath;
+    class LevelFile* mLevelFile;
     int mLevelWidth;
     int mLevelHeight;
     int mTileSize;
     const int mOriginalTileSize = 32;
+    // Size of the ground grid cells, in tiles
+    const int mGroundGridCellTiles = 4;
 
     float mScale;
 
@@ -293,6 +411,9 @@ private:
     // All the UI elements
     std::vector<class UIScreen*> mUIStack;
     std::unordered_map<std::string, class UIFont*> mFonts;
+
+    // Sprite sheet data shared by every animated component, loaded once per file
+    std::unordered_map<std::string, class SpriteSheetAsset*> mSpriteSheets;
     UIScreen* mPauseMenu;
     UIScreen* mOptionsMenu;
     UIScreen* mLevelSelectMenu;
@@ -325,6 +446,8 @@ private:
     void DrawParallaxBackground(SDL_Texture* background);
     void DrawParallaxLayer(SDL_Texture *texture, float parallaxFactor, int y, int h);
     void DrawParallaxLayers(std::vector<SDL_Texture*> backgroundLayers);
+    void DrawTileChunks();
+    void DrawParticles();
 
     bool mUseParallaxBackground;
     SDL_Texture* mBackGroundTextureMainMenu;
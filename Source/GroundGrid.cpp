@@ -0,0 +1,148 @@
+#include "GroundGrid.h"
+#include "Actors/Ground.h"
+#include "Components/AABBComponent.h"
+#include <algorithm>
+#include <cmath>
+
+GroundGrid::GroundGrid(float cellSize)
+    :mCellSize(cellSize)
+{
+}
+
+void GroundGrid::SetCellSize(float cellSize)
+{
+    if (cellSize <= 0.0f || cellSize == mCellSize) {
+        return;
+    }
+
+    std::vector<Ground*> grounds;
+    grounds.reserve(mGroundRanges.size());
+    for (const auto& pair : mGroundRanges) {
+        grounds.emplace_back(pair.first);
+    }
+
+    Clear();
+    mCellSize = cellSize;
+    for (Ground* g : grounds) {
+        Insert(g);
+    }
+}
+
+void GroundGrid::Insert(Ground* ground)
+{
+    if (mGroundRanges.find(ground) != mGroundRanges.end()) {
+        Update(ground);
+        return;
+    }
+
+    CellRange range = GetGroundCellRange(ground);
+    AddToCells(ground, range);
+    mGroundRanges.emplace(ground, range);
+}
+
+void GroundGrid::Remove(Ground* ground)
+{
+    auto iter = mGroundRanges.find(ground);
+    if (iter == mGroundRanges.end()) {
+        return;
+    }
+
+    RemoveFromCells(ground, iter->second);
+    mGroundRanges.erase(iter);
+}
+
+void GroundGrid::Update(Ground* ground)
+{
+    auto iter = mGroundRanges.find(ground);
+    if (iter == mGroundRanges.end()) {
+        return;
+    }
+
+    CellRange range = GetGroundCellRange(ground);
+    if (range == iter->second) {
+        return;
+    }
+
+    RemoveFromCells(ground, iter->second);
+    AddToCells(ground, range);
+    iter->second = range;
+}
+
+void GroundGrid::Clear()
+{
+    mCells.clear();
+    mGroundRanges.clear();
+}
+
+void GroundGrid::Query(const Vector2& min, const Vector2& max, std::vector<Ground*>& grounds) const
+{
+    CellRange range = GetCellRange(min, max);
+
+    for (int y = range.minY; y <= range.maxY; y++) {
+        for (int x = range.minX; x <= range.maxX; x++) {
+            auto iter = mCells.find(GetCellKey(x, y));
+            if (iter == mCells.end()) {
+                continue;
+            }
+
+            for (const CellEntry& entry : iter->second) {
+                // Um ground que ocupa várias células só é reportado na primeira célula em comum com a busca
+                if (x == std::max(entry.mMinX, range.minX) && y == std::max(entry.mMinY, range.minY)) {
+                    grounds.emplace_back(entry.mGround);
+                }
+            }
+        }
+    }
+}
+
+GroundGrid::CellRange GroundGrid::GetCellRange(const Vector2& min, const Vector2& max) const
+{
+    CellRange range;
+    range.minX = static_cast<int>(std::floor(min.x / mCellSize));
+    range.minY = static_cast<int>(std::floor(min.y / mCellSize));
+    range.maxX = static_cast<int>(std::floor(max.x / mCellSize));
+    range.maxY = static_cast<int>(std::floor(max.y / mCellSize));
+    return range;
+}
+
+GroundGrid::CellRange GroundGrid::GetGroundCellRange(Ground* ground) const
+{
+    AABBComponent* aabb = ground->GetAABBComponent();
+    return GetCellRange(aabb->GetWorldMin(), aabb->GetWorldMax());
+}
+
+void GroundGrid::AddToCells(Ground* ground, const CellRange& range)
+{
+    for (int y = range.minY; y <= range.maxY; y++) {
+        for (int x = range.minX; x <= range.maxX; x++) {
+            mCells[GetCellKey(x, y)].emplace_back(CellEntry{ground, range.minX, range.minY});
+        }
+    }
+}
+
+void GroundGrid::RemoveFromCells(Ground* ground, const CellRange& range)
+{
+    for (int y = range.minY; y <= range.maxY; y++) {
+        for (int x = range.minX; x <= range.maxX; x++) {
+            auto iter = mCells.find(GetCellKey(x, y));
+            if (iter == mCells.end()) {
+                continue;
+            }
+
+            std::vector<CellEntry>& entries = iter->second;
+            for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+                if (entry->mGround == ground) {
+                    entries.erase(entry);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+long long GroundGrid::GetCellKey(int x, int y)
+{
+    unsigned long long key = static_cast<unsigned long long>(static_cast<unsigned int>(x)) << 32;
+    key |= static_cast<unsigned int>(y);
+    return static_cast<long long>(key);
+}
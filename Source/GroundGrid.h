@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include "Math.h"
+
+// Uniform grid over the level used as a broadphase for Ground collision queries.
+// Each Ground is stored in every cell its AABB touches; a query only visits the cells
+// overlapping the queried box instead of every Ground in the level.
+class GroundGrid
+{
+public:
+    GroundGrid(float cellSize);
+
+    // Changes the cell size and re-buckets every Ground already in the grid
+    void SetCellSize(float cellSize);
+    float GetCellSize() const { return mCellSize; }
+
+    void Insert(class Ground* ground);
+    void Remove(class Ground* ground);
+
+    // Re-buckets a Ground after it moved or changed size. Cheap when it is still in the same cells
+    void Update(class Ground* ground);
+
+    void Clear();
+
+    // Appends to grounds every Ground whose cells overlap the box (min, max), each one once
+    void Query(const Vector2& min, const Vector2& max, std::vector<class Ground*>& grounds) const;
+
+private:
+    struct CellRange
+    {
+        int minX;
+        int minY;
+        int maxX;
+        int maxY;
+
+        bool operator==(const CellRange& other) const
+        {
+            return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+        }
+    };
+
+    struct CellEntry
+    {
+        class Ground* mGround;
+        // First cell of the ground's range, used to report a ground only once per query
+        int mMinX;
+        int mMinY;
+    };
+
+    CellRange GetCellRange(const Vector2& min, const Vector2& max) const;
+    CellRange GetGroundCellRange(class Ground* ground) const;
+    void AddToCells(class Ground* ground, const CellRange& range);
+    void RemoveFromCells(class Ground* ground, const CellRange& range);
+
+    static long long GetCellKey(int x, int y);
+
+    float mCellSize;
+
+    std::unordered_map<long long, std::vector<CellEntry> > mCells;
+
+    // Cells each ground currently occupies
+    std::unordered_map<class Ground*, CellRange> mGroundRanges;
+};
@@ -0,0 +1,40 @@
+#include "InputRecorder.h"
+
+InputRecorder::InputRecorder(const std::string& recordingPath, unsigned int seed, float fixedDeltaTime)
+    :mRecordingPath(recordingPath)
+    ,mSeed(seed)
+    ,mFixedDeltaTime(fixedDeltaTime)
+{
+}
+
+void InputRecorder::RecordKey(int step, SDL_Scancode scancode, bool isDown)
+{
+    mEvents.emplace_back(KeyEvent{step, scancode, isDown});
+}
+
+bool InputRecorder::Save(int numSteps) const
+{
+    SDL_RWops* file = SDL_RWFromFile(mRecordingPath.c_str(), "wb");
+    if (!file) {
+        SDL_Log("Falha ao criar gravação de entrada %s: %s", mRecordingPath.c_str(), SDL_GetError());
+        return false;
+    }
+
+    SDL_RWwrite(file, "EOIR", 1, 4);
+    SDL_WriteLE32(file, FILE_VERSION);
+    SDL_WriteLE32(file, mSeed);
+    SDL_WriteLE32(file, static_cast<Uint32>(mFixedDeltaTime * 1000000.0f + 0.5f));
+    SDL_WriteLE32(file, static_cast<Uint32>(numSteps));
+    SDL_WriteLE32(file, static_cast<Uint32>(mEvents.size()));
+
+    for (const KeyEvent& keyEvent : mEvents) {
+        SDL_WriteLE32(file, static_cast<Uint32>(keyEvent.mStep));
+        SDL_WriteLE16(file, static_cast<Uint16>(keyEvent.mScancode));
+        SDL_WriteU8(file, keyEvent.mIsDown ? 1 : 0);
+    }
+
+    SDL_RWclose(file);
+    SDL_Log("Gravação de entrada salva em %s (%d passos, %d eventos)", mRecordingPath.c_str(),
+            numSteps, static_cast<int>(mEvents.size()));
+    return true;
+}
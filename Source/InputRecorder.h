@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+// Records every key press and release together with the simulation step it happened on,
+// plus the random seed and step length of the run, so InputScript::LoadRecording can replay
+// the same run deterministically. The recording is kept in memory and written on Save.
+//
+// File layout (little-endian):
+//   "EOIR", version (u32), seed (u32), fixed step in microseconds (u32),
+//   number of steps (u32), number of key events (u32),
+//   then per key event: step (u32), scancode (u16), down (u8)
+class InputRecorder
+{
+public:
+    static const Uint32 FILE_VERSION = 1;
+
+    InputRecorder(const std::string& recordingPath, unsigned int seed, float fixedDeltaTime);
+
+    void RecordKey(int step, SDL_Scancode scancode, bool isDown);
+
+    // Writes the recording; numSteps is how many simulation steps the run lasted
+    bool Save(int numSteps) const;
+
+private:
+    struct KeyEvent
+    {
+        int mStep;
+        SDL_Scancode mScancode;
+        bool mIsDown;
+    };
+
+    std::string mRecordingPath;
+    unsigned int mSeed;
+    float mFixedDeltaTime;
+
+    std::vector<KeyEvent> mEvents;
+};
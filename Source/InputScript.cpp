@@ -0,0 +1,132 @@
+#include "InputScript.h"
+#include "InputRecorder.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+InputScript::InputScript()
+    :mNextEvent(0)
+{
+    std::fill(mKeyState, mKeyState + SDL_NUM_SCANCODES, 0);
+}
+
+bool InputScript::Load(const std::string& scriptPath)
+{
+    std::ifstream scriptFile(scriptPath);
+    if (!scriptFile.is_open()) {
+        SDL_Log("Falha ao abrir script de entrada: %s", scriptPath.c_str());
+        return false;
+    }
+
+    Clear();
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(scriptFile, line)) {
+        lineNumber++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream lineStream(line);
+        int step;
+        std::string keyName;
+        std::string action;
+        if (!(lineStream >> step >> keyName >> action) || (action != "down" && action != "up")) {
+            SDL_Log("Linha %d inválida em %s", lineNumber, scriptPath.c_str());
+            return false;
+        }
+
+        SDL_Scancode scancode = SDL_GetScancodeFromName(keyName.c_str());
+        if (scancode == SDL_SCANCODE_UNKNOWN) {
+            SDL_Log("Tecla desconhecida '%s' na linha %d de %s", keyName.c_str(), lineNumber, scriptPath.c_str());
+            return false;
+        }
+
+        mEvents.emplace_back(KeyEvent{step, scancode, action == "down"});
+    }
+
+    // Mantém a ordem do arquivo entre eventos do mesmo passo
+    std::stable_sort(mEvents.begin(), mEvents.end(), [](const KeyEvent& a, const KeyEvent& b) {
+        return a.mStep < b.mStep;
+    });
+
+    return true;
+}
+
+bool InputScript::LoadRecording(const std::string& recordingPath, unsigned int& seed, float& fixedDeltaTime,
+                                int& numSteps)
+{
+    SDL_RWops* file = SDL_RWFromFile(recordingPath.c_str(), "rb");
+    if (!file) {
+        SDL_Log("Falha ao abrir gravação de entrada %s: %s", recordingPath.c_str(), SDL_GetError());
+        return false;
+    }
+
+    char magic[4];
+    if (SDL_RWread(file, magic, 1, 4) != 4 || std::string(magic, 4) != "EOIR" ||
+        SDL_ReadLE32(file) != InputRecorder::FILE_VERSION)
+    {
+        SDL_Log("Gravação de entrada inválida: %s", recordingPath.c_str());
+        SDL_RWclose(file);
+        return false;
+    }
+
+    seed = SDL_ReadLE32(file);
+    fixedDeltaTime = static_cast<float>(SDL_ReadLE32(file)) / 1000000.0f;
+    numSteps = static_cast<int>(SDL_ReadLE32(file));
+    Uint32 numEvents = SDL_ReadLE32(file);
+
+    // Cada evento ocupa 7 bytes; confere o tamanho antes de reservar memória
+    Sint64 expectedSize = 24 + static_cast<Sint64>(numEvents) * 7;
+    if (SDL_RWsize(file) < expectedSize) {
+        SDL_Log("Gravação de entrada truncada: %s", recordingPath.c_str());
+        SDL_RWclose(file);
+        return false;
+    }
+
+    Clear();
+    mEvents.reserve(numEvents);
+    for (Uint32 i = 0; i < numEvents; i++) {
+        KeyEvent keyEvent;
+        keyEvent.mStep = static_cast<int>(SDL_ReadLE32(file));
+        keyEvent.mScancode = static_cast<SDL_Scancode>(SDL_ReadLE16(file));
+        keyEvent.mIsDown = SDL_ReadU8(file) != 0;
+        if (keyEvent.mScancode >= SDL_NUM_SCANCODES) {
+            SDL_Log("Gravação de entrada com tecla inválida: %s", recordingPath.c_str());
+            SDL_RWclose(file);
+            Clear();
+            return false;
+        }
+        mEvents.emplace_back(keyEvent);
+    }
+
+    SDL_RWclose(file);
+    return true;
+}
+
+void InputScript::Clear()
+{
+    mEvents.clear();
+    mNextEvent = 0;
+    std::fill(mKeyState, mKeyState + SDL_NUM_SCANCODES, 0);
+}
+
+void InputScript::Apply(int step)
+{
+    while (mNextEvent < mEvents.size() && mEvents[mNextEvent].mStep <= step) {
+        const KeyEvent& keyEvent = mEvents[mNextEvent];
+        mKeyState[keyEvent.mScancode] = keyEvent.mIsDown ? 1 : 0;
+
+        // Gera o mesmo evento que o SDL geraria para que menus e atalhos também recebam a tecla
+        SDL_Event event;
+        SDL_memset(&event, 0, sizeof(event));
+        event.type = keyEvent.mIsDown ? SDL_KEYDOWN : SDL_KEYUP;
+        event.key.state = keyEvent.mIsDown ? SDL_PRESSED : SDL_RELEASED;
+        event.key.keysym.scancode = keyEvent.mScancode;
+        event.key.keysym.sym = SDL_GetKeyFromScancode(keyEvent.mScancode);
+        SDL_PushEvent(&event);
+
+        mNextEvent++;
+    }
+}
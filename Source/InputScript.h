@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+// Keyboard input read from a text file, used to drive the game without a player (headless runs).
+// Each line is "<step> <key> <down|up>", e.g. "120 Return down", where step is the simulation
+// step the change happens on and key is an SDL scancode name. Lines starting with # are ignored.
+// Changes are applied to a key state array that replaces SDL_GetKeyboardState, and are also
+// pushed as SDL key events so the UI screens react to them as well.
+class InputScript
+{
+public:
+    InputScript();
+
+    bool Load(const std::string& scriptPath);
+
+    // Loads a binary recording written by InputRecorder. seed, fixedDeltaTime and numSteps
+    // receive the random seed, step length and length in steps of the recorded run
+    bool LoadRecording(const std::string& recordingPath, unsigned int& seed, float& fixedDeltaTime, int& numSteps);
+
+    // Applies every change scheduled up to the given step
+    void Apply(int step);
+
+    const Uint8* GetKeyState() const { return mKeyState; }
+
+    // Whether every change in the script was already applied
+    bool IsFinished() const { return mNextEvent >= mEvents.size(); }
+
+private:
+    void Clear();
+
+    struct KeyEvent
+    {
+        int mStep;
+        SDL_Scancode mScancode;
+        bool mIsDown;
+    };
+
+    std::vector<KeyEvent> mEvents;
+    size_t mNextEvent;
+
+    Uint8 mKeyState[SDL_NUM_SCANCODES];
+};
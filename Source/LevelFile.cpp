@@ -0,0 +1,651 @@
+#include "LevelFile.h"
+#include "Json.h"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <SDL.h>
+
+static_assert(sizeof(int) == sizeof(int32_t), "Tile layers are read as int");
+
+namespace
+{
+    // Seções começam alinhadas a 4 bytes, como os campos das structs
+    size_t AlignedSize(size_t bytes)
+    {
+        return (bytes + 3) & ~static_cast<size_t>(3);
+    }
+
+    // Monta as seções da fase e depois junta tudo em um buffer só
+    class LevelBuilder
+    {
+    public:
+        LevelBuilder()
+            :mWidth(0)
+            ,mHeight(0)
+            ,mTileWidth(0)
+            ,mHasTiles(false)
+            ,mHasDynamicTiles(false)
+            ,mStrings(1, '\0')
+        {
+        }
+
+        uint32_t AddString(const std::string& str)
+        {
+            if (str.empty()) {
+                return 0;
+            }
+            auto iter = mStringOffsets.find(str);
+            if (iter != mStringOffsets.end()) {
+                return iter->second;
+            }
+
+            uint32_t offset = static_cast<uint32_t>(mStrings.size());
+            mStrings.append(str);
+            mStrings.push_back('\0');
+            mStringOffsets.emplace(str, offset);
+            return offset;
+        }
+
+        std::vector<unsigned char> Assemble() const
+        {
+            LevelFileHeader header;
+            std::memset(&header, 0, sizeof(header));
+            header.mMagic = LevelFile::MAGIC;
+            header.mVersion = LevelFile::VERSION;
+            header.mObjectSize = sizeof(LevelObject);
+            header.mWidth = mWidth;
+            header.mHeight = mHeight;
+            header.mTileWidth = mTileWidth;
+
+            size_t size = AlignedSize(sizeof(LevelFileHeader));
+            auto reserve = [&size](size_t bytes) {
+                size_t offset = size;
+                size += AlignedSize(bytes);
+                return static_cast<uint32_t>(offset);
+            };
+
+            size_t tilesBytes = static_cast<size_t>(mWidth) * mHeight * sizeof(int32_t);
+            header.mTilesOffset = mHasTiles ? reserve(tilesBytes) : 0;
+            header.mDynamicTilesOffset = mHasDynamicTiles ? reserve(tilesBytes) : 0;
+            header.mNumTileSprites = static_cast<uint32_t>(mTileSprites.size());
+            header.mTileSpritesOffset = reserve(mTileSprites.size() * sizeof(LevelTileSprite));
+            header.mNumObjects = static_cast<uint32_t>(mObjects.size());
+            header.mObjectsOffset = reserve(mObjects.size() * sizeof(LevelObject));
+            header.mStringsSize = static_cast<uint32_t>(mStrings.size());
+            header.mStringsOffset = reserve(mStrings.size());
+
+            std::vector<unsigned char> data(size, 0);
+            std::memcpy(data.data(), &header, sizeof(header));
+            if (mHasTiles) {
+                std::memcpy(data.data() + header.mTilesOffset, mTiles.data(), tilesBytes);
+            }
+            if (mHasDynamicTiles) {
+                std::memcpy(data.data() + header.mDynamicTilesOffset, mDynamicTiles.data(), tilesBytes);
+            }
+            if (!mTileSprites.empty()) {
+                std::memcpy(data.data() + header.mTileSpritesOffset, mTileSprites.data(),
+                            mTileSprites.size() * sizeof(LevelTileSprite));
+            }
+            if (!mObjects.empty()) {
+                std::memcpy(data.data() + header.mObjectsOffset, mObjects.data(),
+                            mObjects.size() * sizeof(LevelObject));
+            }
+            std::memcpy(data.data() + header.mStringsOffset, mStrings.data(), mStrings.size());
+            return data;
+        }
+
+        int mWidth;
+        int mHeight;
+        int mTileWidth;
+        bool mHasTiles;
+        bool mHasDynamicTiles;
+        std::vector<int32_t> mTiles;
+        std::vector<int32_t> mDynamicTiles;
+        std::vector<LevelTileSprite> mTileSprites;
+        std::vector<LevelObject> mObjects;
+
+    private:
+        std::string mStrings;
+        std::unordered_map<std::string, uint32_t> mStringOffsets;
+    };
+
+    LevelObjectType GetObjectType(const std::string& layerName, const std::string& name)
+    {
+        if (layerName == "Grounds") {
+            return name == "DynamicGround" ? LevelObjectType::DynamicGround : LevelObjectType::Ground;
+        }
+        if (layerName == "Triggers") {
+            return LevelObjectType::Trigger;
+        }
+        if (layerName == "Levers") {
+            return LevelObjectType::Lever;
+        }
+        if (layerName == "Checkpoint") {
+            return LevelObjectType::Checkpoint;
+        }
+        if (layerName == "Player") {
+            return LevelObjectType::Player;
+        }
+        if (layerName == "Enemies") {
+            if (name == "Enemy Simple") return LevelObjectType::EnemySimple;
+            if (name == "Flying Enemy") return LevelObjectType::FlyingEnemy;
+            if (name == "FlyingShooterEnemy") return LevelObjectType::FlyingShooterEnemy;
+            if (name == "Mantis") return LevelObjectType::Mantis;
+            if (name == "Fox") return LevelObjectType::Fox;
+            if (name == "Frog") return LevelObjectType::Frog;
+            if (name == "Moth") return LevelObjectType::Moth;
+            if (name == "BushMonster") return LevelObjectType::BushMonster;
+            if (name == "Golem") return LevelObjectType::Golem;
+        }
+        return LevelObjectType::Unknown;
+    }
+
+    // Campos do LevelObject que as propriedades do Tiled preenchem
+    enum class PropertyKind
+    {
+        Bool,
+        Int,
+        Float,
+        String
+    };
+
+    struct PropertyField
+    {
+        PropertyKind mKind;
+        size_t mOffset;
+    };
+
+    // Tabela montada uma vez: o nome da propriedade leva direto ao campo, sem comparar nome a nome
+    const std::unordered_map<std::string, PropertyField>& GetPropertyFields()
+    {
+        static const std::unordered_map<std::string, PropertyField> fields = {
+            {"Spike", {PropertyKind::Bool, offsetof(LevelObject, mIsSpike)}},
+            {"Moving", {PropertyKind::Bool, offsetof(LevelObject, mIsMoving)}},
+            {"Oscillate", {PropertyKind::Bool, offsetof(LevelObject, mIsOscillating)}},
+            {"GrowthDirection", {PropertyKind::Int, offsetof(LevelObject, mGrowthDirection)}},
+            {"RespawnPositionX", {PropertyKind::Float, offsetof(LevelObject, mRespawnPositionX)}},
+            {"RespawnPositionY", {PropertyKind::Float, offsetof(LevelObject, mRespawnPositionY)}},
+            {"MovingDuration", {PropertyKind::Float, offsetof(LevelObject, mMovingDuration)}},
+            {"SpeedX", {PropertyKind::Float, offsetof(LevelObject, mSpeedX)}},
+            {"SpeedY", {PropertyKind::Float, offsetof(LevelObject, mSpeedY)}},
+            {"GrowSpeedX", {PropertyKind::Float, offsetof(LevelObject, mGrowSpeedX)}},
+            {"GrowSpeedY", {PropertyKind::Float, offsetof(LevelObject, mGrowSpeedY)}},
+            {"MinWidth", {PropertyKind::Float, offsetof(LevelObject, mMinWidth)}},
+            {"MinHeight", {PropertyKind::Float, offsetof(LevelObject, mMinHeight)}},
+            {"Target", {PropertyKind::String, offsetof(LevelObject, mTarget)}},
+            {"Event", {PropertyKind::String, offsetof(LevelObject, mEvent)}},
+            {"Grounds", {PropertyKind::String, offsetof(LevelObject, mGrounds)}},
+            {"Enemies", {PropertyKind::String, offsetof(LevelObject, mEnemies)}},
+            {"Scene", {PropertyKind::String, offsetof(LevelObject, mScene)}},
+            {"FilePath", {PropertyKind::String, offsetof(LevelObject, mFilePath)}},
+            {"CutsceneId", {PropertyKind::String, offsetof(LevelObject, mCutsceneId)}},
+            {"FixedCameraPositionX", {PropertyKind::Float, offsetof(LevelObject, mFixedCameraPositionX)}},
+            {"FixedCameraPositionY", {PropertyKind::Float, offsetof(LevelObject, mFixedCameraPositionY)}},
+            {"MinPosX", {PropertyKind::Float, offsetof(LevelObject, mMinPosX)}},
+            {"MaxPosX", {PropertyKind::Float, offsetof(LevelObject, mMaxPosX)}},
+            {"MinPosY", {PropertyKind::Float, offsetof(LevelObject, mMinPosY)}},
+            {"MaxPosY", {PropertyKind::Float, offsetof(LevelObject, mMaxPosY)}},
+            {"UnlockGrounds", {PropertyKind::String, offsetof(LevelObject, mUnlockGrounds)}}
+        };
+        return fields;
+    }
+
+    // Reads a Tiled map in a single pass, straight into a LevelBuilder, without building the
+    // json tree: tile ids go into the layer's vector as they are parsed and each property is
+    // written to its LevelObject field through GetPropertyFields.
+    // Tiled writes keys in alphabetical order, so a layer's "data" comes before its "name" and
+    // the map's "width" after its "layers"; layers and objects are resolved when they close
+    class TiledMapReader : public nlohmann::json_sax<nlohmann::json>
+    {
+    public:
+        TiledMapReader(LevelBuilder& builder, const std::string& path)
+            :mBuilder(builder)
+            ,mPath(path)
+            ,mHasLayerData(false)
+            ,mNumLayerTiles(0)
+            ,mFirstLayerObject(0)
+            ,mPropertyField(nullptr)
+        {
+        }
+
+        bool null() override
+        {
+            SetNumber(0.0);
+            return true;
+        }
+
+        bool boolean(bool value) override
+        {
+            SetNumber(value ? 1.0 : 0.0);
+            return true;
+        }
+
+        bool number_integer(number_integer_t value) override
+        {
+            if (mScopes.back() == Scope::Data) {
+                mLayerTiles.emplace_back(static_cast<int32_t>(value));
+                return true;
+            }
+            SetNumber(static_cast<double>(value));
+            return true;
+        }
+
+        bool number_unsigned(number_unsigned_t value) override
+        {
+            if (mScopes.back() == Scope::Data) {
+                mLayerTiles.emplace_back(static_cast<int32_t>(value));
+                return true;
+            }
+            SetNumber(static_cast<double>(value));
+            return true;
+        }
+
+        bool number_float(number_float_t value, const string_t&) override
+        {
+            if (mScopes.back() == Scope::Data) {
+                mLayerTiles.emplace_back(static_cast<int32_t>(value));
+                return true;
+            }
+            SetNumber(value);
+            return true;
+        }
+
+        bool string(string_t& value) override
+        {
+            switch (mScopes.back()) {
+                case Scope::Layer:
+                    if (mKey == "name") {
+                        mLayerName = value;
+                    }
+                    break;
+                case Scope::Object:
+                    if (mKey == "name") {
+                        mObjectNames.back() = value;
+                    }
+                    break;
+                case Scope::Property:
+                    if (mKey == "name") {
+                        const auto& fields = GetPropertyFields();
+                        auto iter = fields.find(value);
+                        mPropertyField = iter != fields.end() ? &iter->second : nullptr;
+                    }
+                    else if (mKey == "value") {
+                        mPropertyValue.mIsString = true;
+                        mPropertyValue.mString = value;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            return true;
+        }
+
+        bool binary(binary_t&) override
+        {
+            return true;
+        }
+
+        bool start_object(std::size_t) override
+        {
+            Scope scope = Scope::Skip;
+            if (mScopes.empty()) {
+                scope = Scope::Map;
+            }
+            else if (mScopes.back() == Scope::Layers) {
+                scope = Scope::Layer;
+                BeginLayer();
+            }
+            else if (mScopes.back() == Scope::Objects) {
+                scope = Scope::Object;
+                mBuilder.mObjects.emplace_back();
+                mObjectNames.emplace_back();
+            }
+            else if (mScopes.back() == Scope::Properties) {
+                scope = Scope::Property;
+                mPropertyField = nullptr;
+                mPropertyValue.mIsString = false;
+                mPropertyValue.mNumber = 0.0;
+                mPropertyValue.mString.clear();
+            }
+            mScopes.emplace_back(scope);
+            return true;
+        }
+
+        bool key(string_t& value) override
+        {
+            mKey = value;
+            return true;
+        }
+
+        bool end_object() override
+        {
+            Scope scope = mScopes.back();
+            mScopes.pop_back();
+            if (scope == Scope::Layer) {
+                EndLayer();
+            }
+            else if (scope == Scope::Property && mPropertyField) {
+                SetProperty(mBuilder.mObjects.back(), *mPropertyField);
+            }
+            return true;
+        }
+
+        bool start_array(std::size_t) override
+        {
+            Scope scope = Scope::Skip;
+            Scope parent = mScopes.empty() ? Scope::Skip : mScopes.back();
+            if (parent == Scope::Map && mKey == "layers") {
+                scope = Scope::Layers;
+            }
+            else if (parent == Scope::Layer && mKey == "data") {
+                scope = Scope::Data;
+                mHasLayerData = true;
+            }
+            else if (parent == Scope::Layer && mKey == "objects") {
+                scope = Scope::Objects;
+            }
+            else if (parent == Scope::Object && mKey == "properties") {
+                scope = Scope::Properties;
+            }
+            mScopes.emplace_back(scope);
+            return true;
+        }
+
+        bool end_array() override
+        {
+            mScopes.pop_back();
+            return true;
+        }
+
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) override
+        {
+            SDL_Log("Json inválido: %s (byte %d): %s", mPath.c_str(), static_cast<int>(position), ex.what());
+            return false;
+        }
+
+    private:
+        // Onde o parser está dentro do mapa; o que não interessa à fase é pulado
+        enum class Scope
+        {
+            Map,
+            Layers,
+            Layer,
+            Data,
+            Objects,
+            Object,
+            Properties,
+            Property,
+            Skip
+        };
+
+        // Valor de uma propriedade, guardado até o objeto da propriedade fechar
+        struct PropertyValue
+        {
+            bool mIsString = false;
+            double mNumber = 0.0;
+            std::string mString;
+        };
+
+        void SetNumber(double value)
+        {
+            switch (mScopes.back()) {
+                case Scope::Map:
+                    if (mKey == "width") mBuilder.mWidth = static_cast<int>(value);
+                    else if (mKey == "height") mBuilder.mHeight = static_cast<int>(value);
+                    else if (mKey == "tilewidth") mBuilder.mTileWidth = static_cast<int>(value);
+                    break;
+                case Scope::Object: {
+                    LevelObject& object = mBuilder.mObjects.back();
+                    if (mKey == "id") object.mId = static_cast<int32_t>(value);
+                    else if (mKey == "x") object.mX = static_cast<float>(value);
+                    else if (mKey == "y") object.mY = static_cast<float>(value);
+                    else if (mKey == "width") object.mWidth = static_cast<float>(value);
+                    else if (mKey == "height") object.mHeight = static_cast<float>(value);
+                    break;
+                }
+                case Scope::Property:
+                    if (mKey == "value") {
+                        mPropertyValue.mIsString = false;
+                        mPropertyValue.mNumber = value;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // O Tiled guarda bool, int e float conforme o tipo da propriedade; tipos trocados viram o padrão
+        void SetProperty(LevelObject& object, const PropertyField& field)
+        {
+            unsigned char* dest = reinterpret_cast<unsigned char*>(&object) + field.mOffset;
+            double number = mPropertyValue.mIsString ? 0.0 : mPropertyValue.mNumber;
+            switch (field.mKind) {
+                case PropertyKind::Bool: {
+                    bool value = number != 0.0;
+                    std::memcpy(dest, &value, sizeof(value));
+                    break;
+                }
+                case PropertyKind::Int: {
+                    int32_t value = static_cast<int32_t>(number);
+                    std::memcpy(dest, &value, sizeof(value));
+                    break;
+                }
+                case PropertyKind::Float: {
+                    float value = static_cast<float>(number);
+                    std::memcpy(dest, &value, sizeof(value));
+                    break;
+                }
+                case PropertyKind::String: {
+                    uint32_t value = mPropertyValue.mIsString ? mBuilder.AddString(mPropertyValue.mString) : 0u;
+                    std::memcpy(dest, &value, sizeof(value));
+                    break;
+                }
+            }
+        }
+
+        void BeginLayer()
+        {
+            mLayerName.clear();
+            mHasLayerData = false;
+            // As camadas de tiles do mapa têm todas o mesmo tamanho
+            mLayerTiles.clear();
+            mLayerTiles.reserve(mNumLayerTiles);
+            mFirstLayerObject = mBuilder.mObjects.size();
+            mObjectNames.clear();
+        }
+
+        void EndLayer()
+        {
+            // Os tiles já lidos vão para a camada da fase sem cópia
+            if (mHasLayerData) {
+                mNumLayerTiles = mLayerTiles.size();
+                if (mLayerName == "Camada de Blocos 1") {
+                    mBuilder.mTiles.swap(mLayerTiles);
+                    mBuilder.mHasTiles = true;
+                }
+                else if (mLayerName == "DynamicGrounds") {
+                    mBuilder.mDynamicTiles.swap(mLayerTiles);
+                    mBuilder.mHasDynamicTiles = true;
+                }
+            }
+
+            // Só agora o nome da camada é conhecido: descarta os objetos que o jogo não cria
+            std::vector<LevelObject>& objects = mBuilder.mObjects;
+            size_t numKept = mFirstLayerObject;
+            for (size_t i = mFirstLayerObject; i < objects.size(); i++) {
+                LevelObjectType type = GetObjectType(mLayerName, mObjectNames[i - mFirstLayerObject]);
+                if (type == LevelObjectType::Unknown) {
+                    continue;
+                }
+                objects[i].mType = type;
+                objects[numKept++] = objects[i];
+            }
+            objects.resize(numKept);
+        }
+
+        LevelBuilder& mBuilder;
+        const std::string& mPath;
+        std::vector<Scope> mScopes;
+        // Última chave lida no objeto atual
+        std::string mKey;
+
+        std::string mLayerName;
+        bool mHasLayerData;
+        std::vector<int32_t> mLayerTiles;
+        size_t mNumLayerTiles;
+        size_t mFirstLayerObject;
+        std::vector<std::string> mObjectNames;
+
+        const PropertyField* mPropertyField;
+        PropertyValue mPropertyValue;
+    };
+
+    void CheckTileLayer(const char* layerName, const LevelBuilder& builder, std::vector<int32_t>& tiles)
+    {
+        size_t numTiles = static_cast<size_t>(builder.mWidth) * builder.mHeight;
+        if (tiles.size() != numTiles) {
+            SDL_Log("Camada %s com %d tiles em vez de %d", layerName, static_cast<int>(tiles.size()),
+                    static_cast<int>(numTiles));
+            tiles.resize(numTiles, 0);
+        }
+    }
+}
+
+LevelFile::LevelFile()
+    :mHeader(nullptr)
+{
+}
+
+bool LevelFile::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Uma leitura só, direto para o buffer final
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    mData.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    if (size <= 0 || !file.read(reinterpret_cast<char*>(mData.data()), size)) {
+        SDL_Log("Falha ao ler a fase compilada %s", path.c_str());
+        mData.clear();
+        return false;
+    }
+
+    return Validate(path);
+}
+
+bool LevelFile::LoadJson(const std::string& mapPath, const std::string& tileSetPath)
+{
+    std::ifstream mapFile(mapPath, std::ios::binary);
+    if (!mapFile.is_open()) {
+        SDL_Log("Erro ao abrir o arquivo %s", mapPath.c_str());
+        return false;
+    }
+
+    // Uma passada só pelo arquivo, sem montar a árvore do json
+    LevelBuilder builder;
+    TiledMapReader reader(builder, mapPath);
+    if (!nlohmann::json::sax_parse(mapFile, &reader)) {
+        return false;
+    }
+    if (builder.mHasTiles) {
+        CheckTileLayer("Camada de Blocos 1", builder, builder.mTiles);
+    }
+    if (builder.mHasDynamicTiles) {
+        CheckTileLayer("DynamicGrounds", builder, builder.mDynamicTiles);
+    }
+
+    // Regiões dos tiles: o nome de cada sprite é o índice do tile ("12.png")
+    std::ifstream tileSetFile(tileSetPath);
+    nlohmann::json tileSetData = nlohmann::json::parse(tileSetFile, nullptr, false);
+    if (tileSetData.is_discarded() || !tileSetData.contains("sprites")) {
+        SDL_Log("Tileset inválido ou não encontrado: %s", tileSetPath.c_str());
+    }
+    else {
+        for (const auto& tile : tileSetData["sprites"]) {
+            std::string tileFileName = tile["fileName"];
+            LevelTileSprite sprite;
+            sprite.mIndex = std::stoi(tileFileName.substr(0, tileFileName.find('.')));
+            sprite.mX = tile["x"].get<int32_t>();
+            sprite.mY = tile["y"].get<int32_t>();
+            sprite.mWidth = tile["width"].get<int32_t>();
+            sprite.mHeight = tile["height"].get<int32_t>();
+            builder.mTileSprites.emplace_back(sprite);
+        }
+    }
+
+    mData = builder.Assemble();
+    return Validate(mapPath);
+}
+
+bool LevelFile::Save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        SDL_Log("Falha ao criar %s", path.c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(mData.data()), static_cast<std::streamsize>(mData.size()));
+    return static_cast<bool>(file);
+}
+
+bool LevelFile::Validate(const std::string& path)
+{
+    mHeader = nullptr;
+    if (mData.size() < sizeof(LevelFileHeader)) {
+        SDL_Log("Fase compilada %s está truncada", path.c_str());
+        return false;
+    }
+
+    auto* header = reinterpret_cast<LevelFileHeader*>(mData.data());
+    if (header->mMagic != MAGIC || header->mVersion != VERSION || header->mObjectSize != sizeof(LevelObject)) {
+        SDL_Log("Fase compilada %s é de outra versão, compile de novo", path.c_str());
+        return false;
+    }
+
+    // Toda seção precisa caber no arquivo e estar alinhada
+    auto fits = [this](uint32_t offset, size_t bytes) {
+        return offset % 4 == 0 && offset + bytes <= mData.size();
+    };
+    size_t tilesBytes = static_cast<size_t>(header->mWidth) * header->mHeight * sizeof(int32_t);
+    bool isValid = header->mWidth >= 0 && header->mHeight >= 0 &&
+                   (header->mTilesOffset == 0 || fits(header->mTilesOffset, tilesBytes)) &&
+                   (header->mDynamicTilesOffset == 0 || fits(header->mDynamicTilesOffset, tilesBytes)) &&
+                   fits(header->mTileSpritesOffset, header->mNumTileSprites * sizeof(LevelTileSprite)) &&
+                   fits(header->mObjectsOffset, header->mNumObjects * sizeof(LevelObject)) &&
+                   header->mStringsSize > 0 && fits(header->mStringsOffset, header->mStringsSize) &&
+                   mData[header->mStringsOffset + header->mStringsSize - 1] == '\0';
+    if (!isValid) {
+        SDL_Log("Fase compilada %s está corrompida", path.c_str());
+        return false;
+    }
+
+    mHeader = header;
+    return true;
+}
+
+int* LevelFile::GetTileLayer(uint32_t offset)
+{
+    return offset != 0 ? reinterpret_cast<int*>(mData.data() + offset) : nullptr;
+}
+
+const LevelTileSprite* LevelFile::GetTileSprites() const
+{
+    return reinterpret_cast<const LevelTileSprite*>(mData.data() + mHeader->mTileSpritesOffset);
+}
+
+const LevelObject* LevelFile::GetObjects() const
+{
+    return reinterpret_cast<const LevelObject*>(mData.data() + mHeader->mObjectsOffset);
+}
+
+const char* LevelFile::GetString(uint32_t offset) const
+{
+    if (offset >= mHeader->mStringsSize) {
+        return "";
+    }
+    return reinterpret_cast<const char*>(mData.data() + mHeader->mStringsOffset + offset);
+}
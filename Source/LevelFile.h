@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// What Game::LoadObjects creates for each object of the map
+enum class LevelObjectType : int32_t
+{
+    Unknown,
+    Ground,
+    DynamicGround,
+    Trigger,
+    Lever,
+    EnemySimple,
+    FlyingEnemy,
+    FlyingShooterEnemy,
+    Mantis,
+    Fox,
+    Frog,
+    Moth,
+    BushMonster,
+    Golem,
+    Checkpoint,
+    Player
+};
+
+// One object of the map with every property the game reads, already converted to its type.
+// Positions and sizes are in map pixels (the game scales them); strings are offsets into
+// the string table, 0 being the empty string. Missing properties keep these defaults
+struct LevelObject
+{
+    LevelObjectType mType = LevelObjectType::Unknown;
+    int32_t mId = 0;
+    float mX = 0.0f;
+    float mY = 0.0f;
+    float mWidth = 0.0f;
+    float mHeight = 0.0f;
+
+    // Grounds
+    bool mIsSpike = false;
+    bool mIsMoving = false;
+    bool mIsOscillating = false;
+    int32_t mGrowthDirection = 0;
+    float mRespawnPositionX = 0.0f;
+    float mRespawnPositionY = 0.0f;
+    float mMovingDuration = 0.0f;
+    float mSpeedX = 0.0f;
+    float mSpeedY = 0.0f;
+    float mGrowSpeedX = 0.0f;
+    float mGrowSpeedY = 0.0f;
+    float mMinWidth = 0.0f;
+    float mMinHeight = 0.0f;
+
+    // Triggers and levers
+    uint32_t mTarget = 0;
+    uint32_t mEvent = 0;
+    uint32_t mGrounds = 0;
+    uint32_t mEnemies = 0;
+    uint32_t mScene = 0;
+    uint32_t mFilePath = 0;
+    uint32_t mCutsceneId = 0;
+    float mFixedCameraPositionX = 0.0f;
+    float mFixedCameraPositionY = 0.0f;
+
+    // Enemies
+    float mMinPosX = 0.0f;
+    float mMaxPosX = 0.0f;
+    float mMinPosY = 0.0f;
+    float mMaxPosY = 0.0f;
+    uint32_t mUnlockGrounds = 0;
+};
+
+// Region of one tile in the level's tile sheet
+struct LevelTileSprite
+{
+    int32_t mIndex;
+    int32_t mX;
+    int32_t mY;
+    int32_t mWidth;
+    int32_t mHeight;
+};
+
+// Start of a compiled level file; every offset is in bytes from the start of the file
+struct LevelFileHeader
+{
+    uint32_t mMagic;
+    uint32_t mVersion;
+    // sizeof(LevelObject) of the build that wrote the file
+    uint32_t mObjectSize;
+    int32_t mWidth;
+    int32_t mHeight;
+    int32_t mTileWidth;
+    // mWidth * mHeight tile ids in row order, 0 when the map has no such layer
+    uint32_t mTilesOffset;
+    uint32_t mDynamicTilesOffset;
+    uint32_t mTileSpritesOffset;
+    uint32_t mNumTileSprites;
+    uint32_t mObjectsOffset;
+    uint32_t mNumObjects;
+    uint32_t mStringsOffset;
+    uint32_t mStringsSize;
+};
+
+// Everything LoadLevel needs from a Tiled map and its TileSet.json, kept in one flat buffer:
+// the tile layers, the tile sheet regions, a typed object table and a string table.
+// Compiled levels (.level, written by Tools/LevelCompiler) are loaded with a single read and
+// no parsing; the Tiled json stays the authoring format and compiles to the same buffer.
+// The file is in the native byte order and struct layout of the build that wrote it.
+class LevelFile
+{
+public:
+    static const uint32_t MAGIC = 0x4C56454C; // "LEVL"
+    static const uint32_t VERSION = 1;
+
+    LevelFile();
+
+    // Reads a compiled level; false if it is missing or was written by another version
+    bool Load(const std::string& path);
+    // Compiles a Tiled map and its tile set
+    bool LoadJson(const std::string& mapPath, const std::string& tileSetPath);
+    bool Save(const std::string& path) const;
+
+    int GetWidth() const { return mHeader->mWidth; }
+    int GetHeight() const { return mHeader->mHeight; }
+    int GetTileWidth() const { return mHeader->mTileWidth; }
+
+    // Tile ids of the main and dynamic ground layers, or nullptr if the map lacks the layer
+    int* GetTiles() { return GetTileLayer(mHeader->mTilesOffset); }
+    int* GetDynamicGroundTiles() { return GetTileLayer(mHeader->mDynamicTilesOffset); }
+
+    const LevelTileSprite* GetTileSprites() const;
+    int GetNumTileSprites() const { return static_cast<int>(mHeader->mNumTileSprites); }
+
+    const LevelObject* GetObjects() const;
+    int GetNumObjects() const { return static_cast<int>(mHeader->mNumObjects); }
+
+    const char* GetString(uint32_t offset) const;
+
+    int GetSizeInBytes() const { return static_cast<int>(mData.size()); }
+
+private:
+    int* GetTileLayer(uint32_t offset);
+    // Checks the header and that every section fits in mData
+    bool Validate(const std::string& path);
+
+    std::vector<unsigned char> mData;
+    LevelFileHeader* mHeader;
+};
@@ -0,0 +1,106 @@
+#include "LevelSnapshot.h"
+#include "Actors/Actor.h"
+#include <algorithm>
+
+LevelSnapshot::LevelSnapshot()
+    :mReadOffset(0)
+{
+}
+
+LevelSnapshot::~LevelSnapshot()
+{
+    Clear();
+}
+
+void LevelSnapshot::AddActor(Actor* actor, int objectId)
+{
+    actor->mSnapshotIndex = static_cast<int>(mRecords.size());
+    mRecords.emplace_back(Record{actor, objectId, -1});
+}
+
+void LevelSnapshot::RemoveActor(Actor* actor)
+{
+    int index = actor->mSnapshotIndex;
+    if (index < 0 || index >= static_cast<int>(mRecords.size()) || mRecords[index].mActor != actor) {
+        return;
+    }
+    mRecords[index].mActor = nullptr;
+    actor->mSnapshotIndex = -1;
+}
+
+void LevelSnapshot::Clear()
+{
+    for (const Record& record : mRecords) {
+        if (record.mActor) {
+            record.mActor->mSnapshotIndex = -1;
+        }
+    }
+    mRecords.clear();
+    mBuffer.clear();
+    mReadOffset = 0;
+}
+
+void LevelSnapshot::Capture()
+{
+    mBuffer.clear();
+    for (Record& record : mRecords) {
+        record.mOffset = -1;
+        if (!record.mActor) {
+            continue;
+        }
+
+        // Atores que não sabem salvar o estado descartam o que escreveram
+        size_t start = mBuffer.size();
+        if (record.mActor->SaveState(*this)) {
+            record.mOffset = static_cast<int>(start);
+        }
+        else {
+            mBuffer.resize(start);
+        }
+    }
+}
+
+void LevelSnapshot::Restore(std::vector<int>& objectsToCreate)
+{
+    // Objetos que perderam algum ator (ou não podem ser restaurados) são recriados inteiros
+    objectsToCreate.clear();
+    for (const Record& record : mRecords) {
+        if (!record.mActor || record.mOffset < 0) {
+            objectsToCreate.emplace_back(record.mObjectId);
+        }
+    }
+    std::sort(objectsToCreate.begin(), objectsToCreate.end());
+    objectsToCreate.erase(std::unique(objectsToCreate.begin(), objectsToCreate.end()), objectsToCreate.end());
+
+    std::vector<Actor*> actorsToDelete;
+    for (const Record& record : mRecords) {
+        if (!record.mActor) {
+            continue;
+        }
+
+        if (std::binary_search(objectsToCreate.begin(), objectsToCreate.end(), record.mObjectId)) {
+            actorsToDelete.emplace_back(record.mActor);
+            continue;
+        }
+
+        mReadOffset = static_cast<size_t>(record.mOffset);
+        record.mActor->LoadState(*this);
+    }
+
+    // Deletar chama RemoveActor, que zera os registros desses atores
+    for (Actor* actor : actorsToDelete) {
+        delete actor;
+    }
+
+    // Compacta os registros dos atores que continuam vivos
+    size_t numAlive = 0;
+    for (size_t i = 0; i < mRecords.size(); i++) {
+        if (!mRecords[i].mActor) {
+            continue;
+        }
+        mRecords[numAlive] = mRecords[i];
+        mRecords[numAlive].mActor->mSnapshotIndex = static_cast<int>(numAlive);
+        numAlive++;
+    }
+    mRecords.resize(numAlive);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Mutable state of every actor created from the level's objects, packed in one binary buffer.
+// Game captures it when a level finishes loading; on respawn the actors that are still alive
+// read their state back (a straight copy out of the buffer, no parsing nor allocation) and
+// only the objects that lost an actor since the capture (killed enemies, fired triggers) are
+// created again from the level data.
+// Actors write and read their own fields through Actor::SaveState/LoadState, always in the
+// same order; Write and Read copy raw bytes, so they only take trivially copyable types.
+class LevelSnapshot
+{
+public:
+    LevelSnapshot();
+    ~LevelSnapshot();
+
+    // Registers an actor created for the level object with the given id (its Tiled id)
+    void AddActor(class Actor* actor, int objectId);
+    // Forgets a deleted actor; its object will be created again by the next Restore
+    void RemoveActor(class Actor* actor);
+    // Forgets every actor and the saved state
+    void Clear();
+
+    // Saves the state of every registered actor, replacing the previous capture
+    void Capture();
+    // Loads the saved state back into the registered actors. The objects that lost an actor
+    // (or whose actors can't be restored) have their remaining actors deleted, and their ids
+    // are returned in objectsToCreate, sorted
+    void Restore(std::vector<int>& objectsToCreate);
+
+    bool IsEmpty() const { return mRecords.empty(); }
+    int GetNumActors() const { return static_cast<int>(mRecords.size()); }
+    int GetSizeInBytes() const { return static_cast<int>(mBuffer.size()); }
+
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "LevelSnapshot only stores plain data");
+        size_t offset = mBuffer.size();
+        mBuffer.resize(offset + sizeof(T));
+        std::memcpy(mBuffer.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void Read(T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "LevelSnapshot only stores plain data");
+        std::memcpy(&value, mBuffer.data() + mReadOffset, sizeof(T));
+        mReadOffset += sizeof(T);
+    }
+
+private:
+    struct Record
+    {
+        class Actor* mActor;
+        int mObjectId;
+        // Where the actor's state starts in mBuffer (-1 if it can't be restored)
+        int mOffset;
+    };
+
+    std::vector<Record> mRecords;
+    std::vector<unsigned char> mBuffer;
+    size_t mReadOffset;
+};
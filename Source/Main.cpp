@@ -8,6 +8,8 @@
 
 #define SDL_MAIN_HANDLED
 
+#include <cstdlib>
+#include <string>
 #include "Game.h"
 
 //Screen dimension constants
@@ -28,10 +30,55 @@ const int SCREEN_HEIGHT = 720;
 // const int SCREEN_HEIGHT = 1000;
 const int FPS = 120;
 
+// Usage: game [--headless] [--input-script <file>] [--steps <n>] [--seed <n>]
+//             [--record <file>] [--replay <file>]
+//   --headless            runs without window, renderer or audio, as fast as possible
+//   --input-script <file> drives the keyboard from a script (see InputScript.h)
+//   --steps <n>           quits after n simulation steps
+//   --seed <n>            seeds the random generator with n
+//   --record <file>       records the keyboard input and seed of the run (see InputRecorder.h)
+//   --replay <file>       replays a recording, quitting when it ends
 int main(int argc, char **argv)
 {
     Game game = Game(SCREEN_WIDTH, SCREEN_HEIGHT, FPS);
+
+    std::string inputScriptPath;
+    std::string recordPath;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            game.SetHeadless(true);
+        }
+        else if (arg == "--input-script" && i + 1 < argc) {
+            inputScriptPath = argv[++i];
+        }
+        else if (arg == "--steps" && i + 1 < argc) {
+            game.SetMaxSimulationSteps(std::atoi(argv[++i]));
+        }
+        else if (arg == "--seed" && i + 1 < argc) {
+            game.SetRandomSeed(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc) {
+            if (!game.LoadInputReplay(argv[++i])) {
+                return 1;
+            }
+        }
+        else {
+            SDL_Log("Argumento desconhecido: %s", arg.c_str());
+            return 1;
+        }
+    }
+
     bool success = game.Initialize();
+    if (success && !inputScriptPath.empty()) {
+        success = game.LoadInputScript(inputScriptPath);
+    }
+    if (success && !recordPath.empty()) {
+        success = game.StartInputRecording(recordPath);
+    }
     if (success)
     {
         game.RunLoop();
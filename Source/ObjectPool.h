@@ -0,0 +1,167 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+template <typename T>
+class ObjectPool;
+
+// Base of the objects kept in an ObjectPool<T>. Holds the intrusive free-list link,
+// so acquiring and releasing an object never allocates nor searches
+template <typename T>
+class Pooled
+{
+public:
+    bool GetIsInUse() const { return mIsInUse; }
+
+private:
+    friend class ObjectPool<T>;
+
+    T* mNextFree = nullptr;
+    int mSubPool = -1;
+    bool mIsInUse = false;
+};
+
+// Reusable objects split into sub-pools (e.g. one per projectile type), each with its own
+// free list. Acquire and Release are O(1). A sub-pool may be allowed to grow up to a bound
+// when all its objects are in use; high-water marks tell how many were ever needed at once.
+// The pool does not own the objects: pooled actors belong to the Game like any other actor,
+// so Clear must be called when they are deleted.
+template <typename T>
+class ObjectPool
+{
+public:
+    // Creates a new object for the given sub-pool (used by Reserve and to grow)
+    using Factory = std::function<T*(int subPool)>;
+
+    ObjectPool(int numSubPools, Factory factory);
+
+    // Creates objects until subPool has count of them, and lets it grow up to maxCount
+    // objects when they run out (a smaller maxCount keeps it fixed)
+    void Reserve(int subPool, int count, int maxCount = 0);
+
+    // Returns a free object of subPool, or nullptr if all are in use and it cannot grow
+    T* Acquire(int subPool = 0);
+    // Returns the object to its free list; releasing a free or unknown object does nothing
+    void Release(T* object);
+
+    // Forgets every object, without deleting them
+    void Clear();
+
+    // Every object of every sub-pool, in use or not
+    const std::vector<T*>& GetObjects() const { return mObjects; }
+
+    int GetNumInUse() const { return mNumInUse; }
+    int GetHighWaterMark() const { return mHighWaterMark; }
+    int GetNumInUse(int subPool) const { return mSubPools[subPool].mNumInUse; }
+    int GetHighWaterMark(int subPool) const { return mSubPools[subPool].mHighWaterMark; }
+    int GetCapacity(int subPool) const { return mSubPools[subPool].mNumObjects; }
+
+private:
+    struct SubPool
+    {
+        T* mFirstFree;
+        int mNumObjects;
+        int mMaxObjects;
+        int mNumInUse;
+        int mHighWaterMark;
+    };
+
+    void Create(int subPool);
+
+    Factory mFactory;
+    std::vector<SubPool> mSubPools;
+    std::vector<T*> mObjects;
+    int mNumInUse;
+    int mHighWaterMark;
+};
+
+template <typename T>
+ObjectPool<T>::ObjectPool(int numSubPools, Factory factory)
+    :mFactory(std::move(factory))
+    ,mSubPools(numSubPools, SubPool{nullptr, 0, 0, 0, 0})
+    ,mNumInUse(0)
+    ,mHighWaterMark(0)
+{
+}
+
+template <typename T>
+void ObjectPool<T>::Reserve(int subPool, int count, int maxCount)
+{
+    SubPool& pool = mSubPools[subPool];
+    pool.mMaxObjects = maxCount > count ? maxCount : count;
+    while (pool.mNumObjects < count) {
+        Create(subPool);
+    }
+}
+
+template <typename T>
+void ObjectPool<T>::Create(int subPool)
+{
+    T* object = mFactory(subPool);
+    Pooled<T>* link = object;
+    link->mSubPool = subPool;
+    link->mIsInUse = false;
+
+    SubPool& pool = mSubPools[subPool];
+    link->mNextFree = pool.mFirstFree;
+    pool.mFirstFree = object;
+    pool.mNumObjects++;
+    mObjects.emplace_back(object);
+}
+
+template <typename T>
+T* ObjectPool<T>::Acquire(int subPool)
+{
+    SubPool& pool = mSubPools[subPool];
+    if (!pool.mFirstFree) {
+        if (pool.mNumObjects >= pool.mMaxObjects) {
+            return nullptr;
+        }
+        Create(subPool);
+    }
+
+    T* object = pool.mFirstFree;
+    Pooled<T>* link = object;
+    pool.mFirstFree = link->mNextFree;
+    link->mNextFree = nullptr;
+    link->mIsInUse = true;
+
+    pool.mNumInUse++;
+    if (pool.mNumInUse > pool.mHighWaterMark) {
+        pool.mHighWaterMark = pool.mNumInUse;
+    }
+    mNumInUse++;
+    if (mNumInUse > mHighWaterMark) {
+        mHighWaterMark = mNumInUse;
+    }
+    return object;
+}
+
+template <typename T>
+void ObjectPool<T>::Release(T* object)
+{
+    Pooled<T>* link = object;
+    if (!link->mIsInUse || link->mSubPool < 0) {
+        return;
+    }
+
+    SubPool& pool = mSubPools[link->mSubPool];
+    link->mIsInUse = false;
+    link->mNextFree = pool.mFirstFree;
+    pool.mFirstFree = object;
+    pool.mNumInUse--;
+    mNumInUse--;
+}
+
+template <typename T>
+void ObjectPool<T>::Clear()
+{
+    for (SubPool& pool : mSubPools) {
+        pool.mFirstFree = nullptr;
+        pool.mNumObjects = 0;
+        pool.mNumInUse = 0;
+    }
+    mObjects.clear();
+    mNumInUse = 0;
+}
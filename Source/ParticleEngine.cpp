@@ -0,0 +1,245 @@
+#include "ParticleEngine.h"
+#include "Game.h"
+#include "Random.h"
+#include "SpriteBatch.h"
+#include "TileCollisionLayer.h"
+
+namespace
+{
+    const float GRAVITY_FORCE = 2000.0f;
+    // O sprite da elipse é maior que a partícula por causa da borda transparente
+    const float SPRITE_SCALE = 1.6f;
+    const float SPRITE_ASPECT = 1.2f;
+
+    const float SPLASH_SIZE = 6.0f;
+    const float SPLASH_LIFE_TIME = 0.09f;
+    const int SPLASH_COUNT = 5;
+}
+
+ParticleEngine::ParticleEngine(Game* game)
+    :mGame(game)
+    ,mScale(game->GetScale())
+    ,mTexture(nullptr)
+    ,mTextureRegion(SDL_Rect{0, 0, 0, 0})
+    ,mNumSlots(0)
+    ,mNumAlive(0)
+{
+    mTexture = mGame->LoadTexture("../Assets/Sprites/Particle/Ellipse.png", mTextureRegion);
+
+    mIsAlive.resize(MAX_PARTICLES, 0);
+    mIsSplash.resize(MAX_PARTICLES, 0);
+    mPositionX.resize(MAX_PARTICLES, 0.0f);
+    mPositionY.resize(MAX_PARTICLES, 0.0f);
+    mPreviousX.resize(MAX_PARTICLES, 0.0f);
+    mPreviousY.resize(MAX_PARTICLES, 0.0f);
+    mVelocityX.resize(MAX_PARTICLES, 0.0f);
+    mVelocityY.resize(MAX_PARTICLES, 0.0f);
+    mGravity.resize(MAX_PARTICLES, 0.0f);
+    mLifeTime.resize(MAX_PARTICLES, 0.0f);
+    mWidth.resize(MAX_PARTICLES, 0.0f);
+    mHeight.resize(MAX_PARTICLES, 0.0f);
+    mColor.resize(MAX_PARTICLES, SDL_Color{255, 255, 255, 255});
+
+    Clear();
+}
+
+ParticleEngine::~ParticleEngine()
+{
+    mGame->ReleaseTexture(mTexture);
+    mTexture = nullptr;
+}
+
+void ParticleEngine::Emit(const ParticleParams& params, const Vector2& position, int count)
+{
+    // Faixa de velocidades iniciais conforme a direção, como o antigo Particle::SetDirection
+    float speedScale = params.mSpeedScale * mScale;
+    Vector2 minForce;
+    Vector2 maxForce;
+    if (params.mDirection.x == 1.0f) {
+        minForce = Vector2(300.0f, -800.0f);
+        maxForce = Vector2(800.0f, -140.0f);
+    }
+    else if (params.mDirection.x == -1.0f) {
+        minForce = Vector2(-300.0f, -800.0f);
+        maxForce = Vector2(-800.0f, -140.0f);
+    }
+    else if (params.mDirection.y == -1.0f) {
+        minForce = Vector2(-300.0f, -1300.0f);
+        maxForce = Vector2(300.0f, -450.0f);
+    }
+    else if (params.mDirection.y == 1.0f) {
+        minForce = Vector2(-300.0f, -800.0f);
+        maxForce = Vector2(300.0f, 140.0f);
+    }
+    else {
+        minForce = Vector2(-300.0f, -300.0f);
+        maxForce = Vector2(300.0f, 300.0f);
+    }
+    minForce *= speedScale;
+    maxForce *= speedScale;
+
+    float size = params.mSize * mScale;
+    float gravity = params.mGravity ? GRAVITY_FORCE * mScale : 0.0f;
+
+    for (int n = 0; n < count && !mFreeSlots.empty(); n++) {
+        int i = mFreeSlots.back();
+        mFreeSlots.pop_back();
+        mNumSlots = Math::Max(mNumSlots, i + 1);
+        mNumAlive++;
+
+        Vector2 velocity = Random::GetVector(minForce, maxForce);
+        float particleSize = Random::GetFloatRange(size * 0.5f, size * 1.5f);
+
+        mIsAlive[i] = 1;
+        mIsSplash[i] = params.mIsSplash ? 1 : 0;
+        mPositionX[i] = position.x;
+        mPositionY[i] = position.y;
+        mPreviousX[i] = position.x;
+        mPreviousY[i] = position.y;
+        mVelocityX[i] = velocity.x;
+        mVelocityY[i] = velocity.y;
+        mGravity[i] = gravity;
+        mLifeTime[i] = params.mLifeTime;
+        mWidth[i] = particleSize * SPRITE_ASPECT * SPRITE_SCALE;
+        mHeight[i] = particleSize * SPRITE_SCALE;
+        mColor[i] = params.mColor;
+    }
+}
+
+void ParticleEngine::Kill(int index)
+{
+    mIsAlive[index] = 0;
+    // Zera para que o laço de integração não acumule valores nos espaços livres
+    mVelocityX[index] = 0.0f;
+    mVelocityY[index] = 0.0f;
+    mGravity[index] = 0.0f;
+    mFreeSlots.emplace_back(index);
+    mNumAlive--;
+}
+
+void ParticleEngine::Update(float deltaTime)
+{
+    if (mNumAlive == 0) {
+        mNumSlots = 0;
+        return;
+    }
+
+    int numSlots = mNumSlots;
+
+    // Laço sem desvios sobre os arrays, vetorizável pelo compilador
+    float* positionX = mPositionX.data();
+    float* positionY = mPositionY.data();
+    float* previousX = mPreviousX.data();
+    float* previousY = mPreviousY.data();
+    float* velocityX = mVelocityX.data();
+    float* velocityY = mVelocityY.data();
+    float* lifeTime = mLifeTime.data();
+    const float* gravity = mGravity.data();
+    for (int i = 0; i < numSlots; i++) {
+        previousX[i] = positionX[i];
+        previousY[i] = positionY[i];
+        velocityY[i] += gravity[i] * deltaTime;
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        lifeTime[i] -= deltaTime;
+    }
+
+    // Mata as que expiraram ou bateram no chão
+    const TileCollisionLayer* tileCollision = mGame->GetTileCollision();
+    for (int i = 0; i < numSlots; i++) {
+        if (!mIsAlive[i]) {
+            continue;
+        }
+
+        if (mLifeTime[i] <= 0.0f) {
+            Kill(i);
+        }
+        else if (!mIsSplash[i] && tileCollision &&
+                 tileCollision->IsSolidAt(Vector2(mPositionX[i], mPositionY[i])))
+        {
+            mSplashes.emplace_back(Splash{Vector2(mPositionX[i], mPositionY[i]), mColor[i]});
+            Kill(i);
+        }
+    }
+
+    // Respingos só depois do laço, já que reaproveitam os espaços liberados
+    for (const Splash& splash : mSplashes) {
+        ParticleParams params;
+        params.mSize = SPLASH_SIZE;
+        params.mLifeTime = SPLASH_LIFE_TIME;
+        params.mColor = splash.mColor;
+        params.mIsSplash = true;
+        Emit(params, splash.mPosition, SPLASH_COUNT);
+    }
+    mSplashes.clear();
+}
+
+void ParticleEngine::Draw(SpriteBatch* spriteBatch, const Vector2& cameraPos, float viewWidth, float viewHeight)
+{
+    if (!mTexture || mNumAlive == 0) {
+        return;
+    }
+
+    float alpha = mGame->GetRenderAlpha();
+    for (int i = 0; i < mNumSlots; i++) {
+        if (!mIsAlive[i]) {
+            continue;
+        }
+
+        float x = Math::Lerp(mPreviousX[i], mPositionX[i], alpha) - cameraPos.x;
+        float y = Math::Lerp(mPreviousY[i], mPositionY[i], alpha) - cameraPos.y;
+
+        // Descarta as que estão fora da tela (a largura cobre qualquer rotação)
+        float radius = mWidth[i] * 0.5f;
+        if (x + radius < 0.0f || x - radius > viewWidth || y + radius < 0.0f || y - radius > viewHeight) {
+            continue;
+        }
+
+        SDL_Rect dstRect;
+        dstRect.w = static_cast<int>(mWidth[i]);
+        dstRect.h = static_cast<int>(mHeight[i]);
+        dstRect.x = static_cast<int>(x - mWidth[i] / 2);
+        dstRect.y = static_cast<int>(y - mHeight[i] / 2);
+
+        // Partícula aponta na direção da velocidade
+        float angle = Math::ToDegrees(Math::Atan2(mVelocityY[i], mVelocityX[i]));
+
+        spriteBatch->Draw(mTexture, &mTextureRegion, dstRect, angle, SDL_FLIP_NONE, mColor[i]);
+    }
+}
+
+void ParticleEngine::Clear()
+{
+    for (int i = 0; i < mNumSlots; i++) {
+        mIsAlive[i] = 0;
+        mVelocityX[i] = 0.0f;
+        mVelocityY[i] = 0.0f;
+        mGravity[i] = 0.0f;
+    }
+
+    // Os primeiros espaços ficam no fim da pilha para serem usados antes
+    mFreeSlots.clear();
+    for (int i = MAX_PARTICLES - 1; i >= 0; i--) {
+        mFreeSlots.emplace_back(i);
+    }
+    mNumSlots = 0;
+    mNumAlive = 0;
+    mSplashes.clear();
+}
+
+void ParticleEngine::ChangeResolution(float oldScale, float newScale)
+{
+    float factor = newScale / oldScale;
+    for (int i = 0; i < mNumSlots; i++) {
+        mPositionX[i] *= factor;
+        mPositionY[i] *= factor;
+        mPreviousX[i] *= factor;
+        mPreviousY[i] *= factor;
+        mVelocityX[i] *= factor;
+        mVelocityY[i] *= factor;
+        mGravity[i] *= factor;
+        mWidth[i] *= factor;
+        mHeight[i] *= factor;
+    }
+    mScale = newScale;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "Math.h"
+
+// Parameters of one emission. Sizes and speeds are in unscaled units (as if Game::GetScale
+// were 1); the engine applies the current scale when it emits
+struct ParticleParams
+{
+    // Each particle gets a random size between half and one and a half times mSize
+    float mSize = 8.0f;
+    float mLifeTime = 0.7f;
+    float mSpeedScale = 1.0f;
+    // Main direction of the initial velocities (a unit axis), or zero to spread in all directions
+    Vector2 mDirection = Vector2::Zero;
+    SDL_Color mColor = SDL_Color{255, 255, 255, 255};
+    bool mGravity = true;
+    // Splash particles die silently on the ground; the others splash again when they hit it
+    bool mIsSplash = false;
+};
+
+// Every particle of the level, stored as parallel arrays (structure of arrays) with a fixed
+// capacity. Dead slots go to a free list, so emitting never allocates nor touches the actor
+// list; when all slots are taken new particles are dropped.
+// Ground collision only asks the TileCollisionLayer whether the particle's center is inside
+// a solid tile, so particles go through moving grounds.
+class ParticleEngine
+{
+public:
+    static const int MAX_PARTICLES = 8192;
+
+    explicit ParticleEngine(class Game* game);
+    ~ParticleEngine();
+
+    void Emit(const ParticleParams& params, const Vector2& position, int count);
+
+    // Moves all particles and kills the expired ones and those that hit the ground
+    void Update(float deltaTime);
+    // Submits the visible particles to the sprite batch
+    void Draw(class SpriteBatch* spriteBatch, const Vector2& cameraPos, float viewWidth, float viewHeight);
+
+    // Kills every particle (used when the scene is unloaded)
+    void Clear();
+    void ChangeResolution(float oldScale, float newScale);
+
+    int GetNumParticles() const { return mNumAlive; }
+
+private:
+    struct Splash
+    {
+        Vector2 mPosition;
+        SDL_Color mColor;
+    };
+
+    void Kill(int index);
+
+    class Game* mGame;
+    float mScale;
+
+    SDL_Texture* mTexture;
+    SDL_Rect mTextureRegion;
+
+    // Free slots, and how many slots from the start of the arrays were ever used
+    std::vector<int> mFreeSlots;
+    int mNumSlots;
+    int mNumAlive;
+
+    std::vector<unsigned char> mIsAlive;
+    std::vector<unsigned char> mIsSplash;
+    std::vector<float> mPositionX;
+    std::vector<float> mPositionY;
+    std::vector<float> mPreviousX;
+    std::vector<float> mPreviousY;
+    std::vector<float> mVelocityX;
+    std::vector<float> mVelocityY;
+    // Downward acceleration, zero for particles without gravity
+    std::vector<float> mGravity;
+    // Remaining life in seconds
+    std::vector<float> mLifeTime;
+    // Size of the drawn sprite
+    std::vector<float> mWidth;
+    std::vector<float> mHeight;
+    std::vector<SDL_Color> mColor;
+
+    // Ground hits of the last update, splashed once the update loop is over
+    std::vector<Splash> mSplashes;
+};
@@ -0,0 +1,154 @@
+#include "PerfOverlay.h"
+#include "Game.h"
+#include "FramePacer.h"
+#include "TextureCache.h"
+#include "AudioSystem.h"
+#include "ParticleEngine.h"
+#include <cstdio>
+#include <cstring>
+
+PerfOverlay::PerfOverlay(class Game* game, const std::string& fontName)
+    :UIScreen(game, fontName, false)
+    ,mRefreshTimer(0.0f)
+    ,mUpdateTimeSum(0.0f)
+    ,mDrawTimeSum(0.0f)
+    ,mPresentTimeSum(0.0f)
+    ,mNumSamples(0)
+{
+    float scale = mGame->GetScale();
+    mSize = Vector2(PANEL_WIDTH, NumLines * LINE_HEIGHT + GRAPH_HEIGHT + 20.0f) * scale;
+    mPos = Vector2(10.0f * scale, mGame->GetLogicalWindowHeight() - mSize.y - 10.0f * scale);
+
+    for (int i = 0; i < NumLines; i++) {
+        mLines.emplace_back(AddText(" ", Vector2(10.0f, 5.0f + i * LINE_HEIGHT) * scale,
+                                    Vector2::Zero, static_cast<int>(POINT_SIZE * scale)));
+        mLineTexts.emplace_back(" ");
+    }
+
+    mFrameTimes.reserve(FramePacer::HISTORY_SIZE);
+    mGraphPoints.resize(FramePacer::HISTORY_SIZE);
+
+    RefreshTexts();
+}
+
+void PerfOverlay::Update(float deltaTime)
+{
+    if (!mIsVisible) {
+        return;
+    }
+
+    mUpdateTimeSum += mGame->GetLastUpdateTime();
+    mDrawTimeSum += mGame->GetLastDrawTime();
+    mPresentTimeSum += mGame->GetLastPresentTime();
+    mNumSamples++;
+
+    mRefreshTimer += deltaTime;
+    if (mRefreshTimer >= REFRESH_INTERVAL) {
+        mRefreshTimer = 0.0f;
+        RefreshTexts();
+    }
+}
+
+void PerfOverlay::RefreshTexts()
+{
+    FramePacer* framePacer = mGame->GetFramePacer();
+    float averageFrameTime = framePacer->GetAverageFrameTime();
+    float samples = mNumSamples > 0 ? static_cast<float>(mNumSamples) : 1.0f;
+
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "FPS %.0f   quadro %.2f ms   p99 %.2f ms",
+             averageFrameTime > 0.0f ? 1.0f / averageFrameTime : 0.0f,
+             averageFrameTime * 1000.0f, framePacer->GetFrameTimePercentile(0.99f) * 1000.0f);
+    SetLine(FrameLine, mLineBuffer);
+
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "update %.2f ms   draw %.2f ms   present %.2f ms",
+             mUpdateTimeSum / samples * 1000.0f, mDrawTimeSum / samples * 1000.0f,
+             mPresentTimeSum / samples * 1000.0f);
+    SetLine(SplitLine, mLineBuffer);
+
+    // Pools mostram os objetos em uso e o pico da sessão
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "atores %d   partículas %d   projéteis %d (pico %d)",
+             mGame->GetNumActors(), mGame->GetParticles()->GetNumParticles(),
+             mGame->GetProjectilePool().GetNumInUse(), mGame->GetProjectilePool().GetHighWaterMark());
+    SetLine(ActorsLine, mLineBuffer);
+
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "moedas %d (pico %d)   inimigos %d   drawables %d",
+             mGame->GetMoneyPool().GetNumInUse(), mGame->GetMoneyPool().GetHighWaterMark(),
+             static_cast<int>(mGame->GetEnemies().size()), mGame->GetNumDrawables());
+    SetLine(CountsLine, mLineBuffer);
+
+    TextureCache* textureCache = mGame->GetTextureCache();
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "draw calls %d   texturas %d (%.1f MB)",
+             mGame->GetLastDrawCalls(), textureCache->GetNumTextures(),
+             static_cast<float>(textureCache->GetTextureBytes()) / (1024.0f * 1024.0f));
+    SetLine(DrawCallsLine, mLineBuffer);
+
+    AudioSystem* audio = mGame->GetAudio();
+    snprintf(mLineBuffer, sizeof(mLineBuffer), "áudio %d/%d canais",
+             audio->GetNumActiveChannels(), audio->GetNumChannels());
+    SetLine(AudioLine, mLineBuffer);
+
+    mUpdateTimeSum = 0.0f;
+    mDrawTimeSum = 0.0f;
+    mPresentTimeSum = 0.0f;
+    mNumSamples = 0;
+}
+
+void PerfOverlay::SetLine(Line line, const char* text)
+{
+    // Só rasteriza o texto de novo quando ele muda
+    if (mLineTexts[line] == text) {
+        return;
+    }
+
+    mLineTexts[line] = text;
+    mLines[line]->SetText(mLineTexts[line]);
+}
+
+void PerfOverlay::Draw(SDL_Renderer *renderer)
+{
+    if (!mIsVisible) {
+        return;
+    }
+
+    SDL_Rect panel = {static_cast<int>(mPos.x), static_cast<int>(mPos.y),
+                      static_cast<int>(mSize.x), static_cast<int>(mSize.y)};
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &panel);
+
+    UIScreen::Draw(renderer);
+    DrawFrameGraph(renderer);
+}
+
+void PerfOverlay::DrawFrameGraph(SDL_Renderer *renderer)
+{
+    float scale = mGame->GetScale();
+    float left = mPos.x + 10.0f * scale;
+    float width = mSize.x - 20.0f * scale;
+    float height = GRAPH_HEIGHT * scale;
+    float bottom = mPos.y + mSize.y - 10.0f * scale;
+
+    // O gráfico vai de zero a duas vezes o tempo de quadro alvo
+    float targetFrameTime = 1.0f / static_cast<float>(mGame->GetFPS());
+    float maxFrameTime = 2.0f * targetFrameTime;
+
+    SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+    int targetY = static_cast<int>(bottom - height * 0.5f);
+    SDL_RenderDrawLine(renderer, static_cast<int>(left), targetY, static_cast<int>(left + width), targetY);
+
+    mGame->GetFramePacer()->GetFrameTimeHistory(mFrameTimes);
+    int numPoints = static_cast<int>(mFrameTimes.size());
+    if (numPoints < 2) {
+        return;
+    }
+
+    float step = width / static_cast<float>(FramePacer::HISTORY_SIZE - 1);
+    for (int i = 0; i < numPoints; i++) {
+        float t = Math::Min(mFrameTimes[i] / maxFrameTime, 1.0f);
+        mGraphPoints[i].x = static_cast<int>(left + step * i);
+        mGraphPoints[i].y = static_cast<int>(bottom - height * t);
+    }
+
+    SDL_SetRenderDrawColor(renderer, 80, 220, 120, 255);
+    SDL_RenderDrawLines(renderer, mGraphPoints.data(), numPoints);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "UIElements/UIScreen.h"
+
+// Toggleable panel (F3) with frame time graph, update/draw/present split, actor and
+// drawable counts, draw calls, texture memory and audio channels. It lives outside the
+// UI stack so it survives scene changes and never takes input from the menus.
+// Texts are refreshed a few times per second and only re-rasterized when they change;
+// the graph reuses preallocated buffers, so drawing it does not allocate.
+class PerfOverlay : public UIScreen
+{
+public:
+    const int POINT_SIZE = 20;
+    const float LINE_HEIGHT = 24.0f;
+    const float PANEL_WIDTH = 520.0f;
+    const float GRAPH_HEIGHT = 80.0f;
+    const float REFRESH_INTERVAL = 0.25f;
+
+    PerfOverlay(class Game* game, const std::string& fontName);
+
+    void Update(float deltaTime) override;
+    void Draw(class SDL_Renderer *renderer) override;
+
+private:
+    enum Line
+    {
+        FrameLine,
+        SplitLine,
+        ActorsLine,
+        CountsLine,
+        DrawCallsLine,
+        AudioLine,
+        NumLines
+    };
+
+    void RefreshTexts();
+    void SetLine(Line line, const char* text);
+    void DrawFrameGraph(class SDL_Renderer *renderer);
+
+    std::vector<UIText*> mLines;
+    // Text currently rasterized in each line
+    std::vector<std::string> mLineTexts;
+    char mLineBuffer[128];
+
+    float mRefreshTimer;
+
+    // Sums since the last refresh, averaged when the texts are refreshed
+    float mUpdateTimeSum;
+    float mDrawTimeSum;
+    float mPresentTimeSum;
+    int mNumSamples;
+
+    std::vector<float> mFrameTimes;
+    std::vector<SDL_Point> mGraphPoints;
+};
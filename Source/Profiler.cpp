@@ -0,0 +1,173 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+std::mutex Profiler::sMutex;
+thread_local std::vector<Profiler::OpenZone> Profiler::sOpenZones;
+std::vector<Profiler::ZoneRecord> Profiler::sFrames[Profiler::FRAME_HISTORY];
+Uint64 Profiler::sFrameStart = 0;
+int Profiler::sCurrentFrame = 0;
+int Profiler::sNumFrames = 0;
+
+void Profiler::BeginZone(const char* name)
+{
+    sOpenZones.emplace_back(OpenZone{name, SDL_GetPerformanceCounter()});
+}
+
+void Profiler::EndZone()
+{
+    if (sOpenZones.empty()) {
+        return;
+    }
+
+    OpenZone zone = sOpenZones.back();
+    sOpenZones.pop_back();
+
+    ZoneRecord record;
+    record.mName = zone.mName;
+    record.mStart = zone.mStart;
+    record.mEnd = SDL_GetPerformanceCounter();
+    record.mThreadId = SDL_ThreadID();
+    AddRecord(record);
+}
+
+void Profiler::EndFrame()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    std::lock_guard<std::mutex> lock(sMutex);
+
+    if (sFrameStart != 0) {
+        // Zona do quadro inteiro, usada também no resumo do tempo de quadro
+        sFrames[sCurrentFrame].emplace_back(ZoneRecord{"Frame", sFrameStart, now, SDL_ThreadID()});
+    }
+
+    sCurrentFrame = (sCurrentFrame + 1) % FRAME_HISTORY;
+    sFrames[sCurrentFrame].clear();
+    sNumFrames = std::min(sNumFrames + 1, FRAME_HISTORY - 1);
+    sFrameStart = now;
+}
+
+void Profiler::AddRecord(const ZoneRecord& record)
+{
+    std::lock_guard<std::mutex> lock(sMutex);
+    if (sFrameStart == 0) {
+        sFrameStart = record.mStart;
+    }
+    sFrames[sCurrentFrame].emplace_back(record);
+}
+
+bool Profiler::ExportChromeTrace(const std::string& tracePath)
+{
+    std::ofstream traceFile(tracePath);
+    if (!traceFile.is_open()) {
+        SDL_Log("Falha ao criar trace %s", tracePath.c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(sMutex);
+
+    // Quadros completos, do mais antigo ao mais recente
+    int firstFrame = (sCurrentFrame - sNumFrames + FRAME_HISTORY) % FRAME_HISTORY;
+
+    // As zonas são guardadas na ordem em que terminam, então a origem é o menor início
+    Uint64 origin = 0;
+    bool first = true;
+    for (int i = 0; i < sNumFrames; i++) {
+        for (const ZoneRecord& record : sFrames[(firstFrame + i) % FRAME_HISTORY]) {
+            if (first || record.mStart < origin) {
+                origin = record.mStart;
+            }
+            first = false;
+        }
+    }
+    first = true;
+
+    traceFile << std::fixed << std::setprecision(3);
+    traceFile << "{\"traceEvents\":[\n";
+    for (int i = 0; i < sNumFrames; i++) {
+        for (const ZoneRecord& record : sFrames[(firstFrame + i) % FRAME_HISTORY]) {
+            double start = CounterToMicroseconds(record.mStart - origin);
+
+            traceFile << (first ? "" : ",\n")
+                      << "{\"name\":\"" << GetDisplayName(record.mName) << "\",\"ph\":\"X\",\"pid\":0"
+                      << ",\"tid\":" << record.mThreadId
+                      << ",\"ts\":" << start
+                      << ",\"dur\":" << CounterToMicroseconds(record.mEnd - record.mStart) << "}";
+            first = false;
+        }
+    }
+    traceFile << "\n]}\n";
+
+    SDL_Log("Trace do profiler salvo em %s (%d quadros)", tracePath.c_str(), sNumFrames);
+    return true;
+}
+
+void Profiler::GetSummary(std::vector<ZoneStats>& stats)
+{
+    stats.clear();
+
+    std::lock_guard<std::mutex> lock(sMutex);
+    if (sNumFrames == 0) {
+        return;
+    }
+
+    // Tempo total de cada zona em cada quadro; quadros sem a zona contam como zero
+    std::map<std::string, std::vector<float> > frameTimes;
+    int firstFrame = (sCurrentFrame - sNumFrames + FRAME_HISTORY) % FRAME_HISTORY;
+    for (int i = 0; i < sNumFrames; i++) {
+        for (const ZoneRecord& record : sFrames[(firstFrame + i) % FRAME_HISTORY]) {
+            std::vector<float>& times = frameTimes[GetDisplayName(record.mName)];
+            times.resize(sNumFrames, 0.0f);
+            times[i] += static_cast<float>(CounterToMicroseconds(record.mEnd - record.mStart) / 1000.0);
+        }
+    }
+
+    for (auto& pair : frameTimes) {
+        std::vector<float>& times = pair.second;
+        ZoneStats zoneStats;
+        zoneStats.mName = pair.first;
+
+        float sum = 0.0f;
+        for (float time : times) {
+            sum += time;
+        }
+        zoneStats.mAverage = sum / static_cast<float>(times.size());
+
+        std::sort(times.begin(), times.end());
+        zoneStats.mP50 = times[(times.size() - 1) / 2];
+        zoneStats.mP99 = times[static_cast<size_t>(0.99f * static_cast<float>(times.size() - 1))];
+        stats.emplace_back(zoneStats);
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const ZoneStats& a, const ZoneStats& b) {
+        return a.mP99 > b.mP99;
+    });
+}
+
+void Profiler::LogSummary(int maxZones)
+{
+    std::vector<ZoneStats> stats;
+    GetSummary(stats);
+
+    SDL_Log("%-32s %10s %10s %10s", "Zona", "média ms", "p50 ms", "p99 ms");
+    for (int i = 0; i < static_cast<int>(stats.size()) && i < maxZones; i++) {
+        SDL_Log("%-32s %10.3f %10.3f %10.3f", stats[i].mName.c_str(), stats[i].mAverage, stats[i].mP50, stats[i].mP99);
+    }
+}
+
+const char* Profiler::GetDisplayName(const char* name)
+{
+    while (std::isdigit(static_cast<unsigned char>(*name))) {
+        name++;
+    }
+    return name;
+}
+
+double Profiler::CounterToMicroseconds(Uint64 counter)
+{
+    return static_cast<double>(counter) * 1000000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+// Lightweight scoped CPU profiler. PROFILE_SCOPE("Name") opens a zone that closes at the end
+// of the enclosing scope; zones can nest. PROFILE_FRAME() marks the end of a frame. Completed
+// zones are kept per frame for the last FRAME_HISTORY frames, and can be exported as a Chrome
+// trace (chrome://tracing or Perfetto) or summarised as rolling p50/p99 times per zone.
+// Zone names are not copied, so they must be string literals or typeid names.
+// The macros compile to nothing unless ENABLE_PROFILER is defined (CMake option ENABLE_PROFILER).
+class Profiler
+{
+public:
+    static const int FRAME_HISTORY = 600;
+
+    // Time spent in a zone per frame, in milliseconds, over the stored frames
+    struct ZoneStats
+    {
+        std::string mName;
+        float mAverage;
+        float mP50;
+        float mP99;
+    };
+
+    static void BeginZone(const char* name);
+    static void EndZone();
+    static void EndFrame();
+
+    // Writes every stored zone as a Chrome trace event file
+    static bool ExportChromeTrace(const std::string& tracePath);
+
+    // Fills stats with one entry per zone name, slowest p99 first
+    static void GetSummary(std::vector<ZoneStats>& stats);
+    static void LogSummary(int maxZones = 25);
+
+private:
+    struct ZoneRecord
+    {
+        const char* mName;
+        Uint64 mStart;
+        Uint64 mEnd;
+        unsigned long mThreadId;
+    };
+
+    struct OpenZone
+    {
+        const char* mName;
+        Uint64 mStart;
+    };
+
+    static void AddRecord(const ZoneRecord& record);
+    // Skips the length prefix of typeid names (e.g. "6Player" -> "Player")
+    static const char* GetDisplayName(const char* name);
+    static double CounterToMicroseconds(Uint64 counter);
+
+    static std::mutex sMutex;
+
+    // Zones still open on each thread
+    static thread_local std::vector<OpenZone> sOpenZones;
+
+    // Ring buffer with the zones of the last frames. Vectors keep their capacity
+    // when a slot is reused, so recording does not allocate once warmed up
+    static std::vector<ZoneRecord> sFrames[FRAME_HISTORY];
+    static Uint64 sFrameStart;
+    static int sCurrentFrame;
+    static int sNumFrames;
+};
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name) { Profiler::BeginZone(name); }
+    ~ProfileScope() { Profiler::EndZone(); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#ifdef ENABLE_PROFILER
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FRAME() Profiler::EndFrame()
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FRAME()
+#endif
@@ -16,6 +16,7 @@ void Random::Init()
 
 void Random::Seed(unsigned int seed)
 {
+	sSeed = seed;
 	sGenerator.seed(seed);
 }
 
@@ -49,3 +50,4 @@ Vector3 Random::GetVector(const Vector3& min, const Vector3& max)
 }
 
 std::mt19937 Random::sGenerator;
+unsigned int Random::sSeed = 0;
@@ -19,6 +19,9 @@ public:
 	// NOTE: You should generally not need to manually use this
 	static void Seed(unsigned int seed);
 
+	// Seed the generator was last seeded with, so a run can be reproduced
+	static unsigned int GetSeed() { return sSeed; }
+
 	// Get a float between 0.0f and 1.0f
 	static float GetFloat();
 	
@@ -33,4 +36,5 @@ public:
 	static Vector3 GetVector(const Vector3& min, const Vector3& max);
 private:
 	static std::mt19937 sGenerator;
+	static unsigned int sSeed;
 };
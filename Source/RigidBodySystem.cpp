@@ -0,0 +1,147 @@
+#include "RigidBodySystem.h"
+#include "Actors/Actor.h"
+#include <algorithm>
+
+RigidBodySystem::RigidBodySystem()
+{
+}
+
+int RigidBodySystem::Add(class Actor* owner, float mass, float maxSpeedX, float maxSpeedY)
+{
+    int handle;
+    if (!mFreeHandles.empty()) {
+        handle = mFreeHandles.back();
+        mFreeHandles.pop_back();
+    }
+    else {
+        handle = static_cast<int>(mIndices.size());
+        mIndices.emplace_back(-1);
+    }
+
+    mIndices[handle] = static_cast<int>(mOwners.size());
+    mHandles.emplace_back(handle);
+    mOwners.emplace_back(owner);
+    mIsActive.emplace_back(0);
+    mVelocityX.emplace_back(0.0f);
+    mVelocityY.emplace_back(0.0f);
+    mAccelerationX.emplace_back(0.0f);
+    mAccelerationY.emplace_back(0.0f);
+    mInverseMass.emplace_back(1.0f / mass);
+    mMaxSpeedX.emplace_back(maxSpeedX);
+    mMaxSpeedY.emplace_back(maxSpeedY);
+    mAngularSpeed.emplace_back(0.0f);
+    mDisplacementX.emplace_back(0.0f);
+    mDisplacementY.emplace_back(0.0f);
+    return handle;
+}
+
+void RigidBodySystem::Remove(int handle)
+{
+    if (handle < 0 || handle >= static_cast<int>(mIndices.size()) || mIndices[handle] < 0) {
+        return;
+    }
+
+    // O último corpo ocupa o lugar do removido
+    int index = mIndices[handle];
+    int last = static_cast<int>(mOwners.size()) - 1;
+    if (index != last) {
+        mHandles[index] = mHandles[last];
+        mIndices[mHandles[index]] = index;
+        mOwners[index] = mOwners[last];
+        mIsActive[index] = mIsActive[last];
+        mVelocityX[index] = mVelocityX[last];
+        mVelocityY[index] = mVelocityY[last];
+        mAccelerationX[index] = mAccelerationX[last];
+        mAccelerationY[index] = mAccelerationY[last];
+        mInverseMass[index] = mInverseMass[last];
+        mMaxSpeedX[index] = mMaxSpeedX[last];
+        mMaxSpeedY[index] = mMaxSpeedY[last];
+        mAngularSpeed[index] = mAngularSpeed[last];
+        mDisplacementX[index] = mDisplacementX[last];
+        mDisplacementY[index] = mDisplacementY[last];
+    }
+
+    mHandles.pop_back();
+    mOwners.pop_back();
+    mIsActive.pop_back();
+    mVelocityX.pop_back();
+    mVelocityY.pop_back();
+    mAccelerationX.pop_back();
+    mAccelerationY.pop_back();
+    mInverseMass.pop_back();
+    mMaxSpeedX.pop_back();
+    mMaxSpeedY.pop_back();
+    mAngularSpeed.pop_back();
+    mDisplacementX.pop_back();
+    mDisplacementY.pop_back();
+
+    mIndices[handle] = -1;
+    mFreeHandles.emplace_back(handle);
+}
+
+void RigidBodySystem::SetVelocity(int handle, const Vector2& velocity)
+{
+    int i = mIndices[handle];
+    mVelocityX[i] = velocity.x;
+    mVelocityY[i] = velocity.y;
+}
+
+void RigidBodySystem::SetAcceleration(int handle, const Vector2& acceleration)
+{
+    int i = mIndices[handle];
+    mAccelerationX[i] = acceleration.x;
+    mAccelerationY[i] = acceleration.y;
+}
+
+void RigidBodySystem::ApplyForce(int handle, const Vector2& force)
+{
+    int i = mIndices[handle];
+    mAccelerationX[i] += force.x * mInverseMass[i];
+    mAccelerationY[i] += force.y * mInverseMass[i];
+}
+
+void RigidBodySystem::Integrate(float deltaTime)
+{
+    int numBodies = static_cast<int>(mOwners.size());
+
+    // Só integra corpos de atores que vão ser atualizados
+    for (int i = 0; i < numBodies; i++) {
+        mIsActive[i] = mOwners[i]->GetState() == ActorState::Active ? 1 : 0;
+    }
+
+    // Laço sem desvios sobre os arrays, vetorizável pelo compilador
+    float* velocityX = mVelocityX.data();
+    float* velocityY = mVelocityY.data();
+    float* accelerationX = mAccelerationX.data();
+    float* accelerationY = mAccelerationY.data();
+    float* displacementX = mDisplacementX.data();
+    float* displacementY = mDisplacementY.data();
+    const float* maxSpeedX = mMaxSpeedX.data();
+    const float* maxSpeedY = mMaxSpeedY.data();
+    const unsigned char* isActive = mIsActive.data();
+    for (int i = 0; i < numBodies; i++) {
+        float newVelocityX = std::min(std::max(velocityX[i] + accelerationX[i] * deltaTime, -maxSpeedX[i]), maxSpeedX[i]);
+        float newVelocityY = std::min(std::max(velocityY[i] + accelerationY[i] * deltaTime, -maxSpeedY[i]), maxSpeedY[i]);
+
+        bool active = isActive[i] != 0;
+        velocityX[i] = active ? newVelocityX : velocityX[i];
+        velocityY[i] = active ? newVelocityY : velocityY[i];
+        displacementX[i] = active ? newVelocityX * deltaTime : displacementX[i];
+        displacementY[i] = active ? newVelocityY * deltaTime : displacementY[i];
+        accelerationX[i] = active ? 0.0f : accelerationX[i];
+        accelerationY[i] = active ? 0.0f : accelerationY[i];
+    }
+
+    // Aplica o deslocamento e a rotação nos donos
+    for (int i = 0; i < numBodies; i++) {
+        if (!mIsActive[i]) {
+            continue;
+        }
+
+        Actor* owner = mOwners[i];
+        owner->SetPosition(owner->GetPosition() + Vector2(mDisplacementX[i], mDisplacementY[i]));
+        if (mAngularSpeed[i] != 0.0f) {
+            owner->SetRotation(owner->GetRotation() + mAngularSpeed[i] * deltaTime);
+        }
+    }
+}
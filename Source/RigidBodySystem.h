@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include "Math.h"
+
+// Rigid-body state of every RigidBodyComponent, stored as parallel arrays (structure of
+// arrays) so Integrate updates all bodies in one tight loop the compiler can vectorize.
+// Components keep a handle, which stays valid until the body is removed; removing a body
+// moves the last one into its place, so the arrays never have holes.
+// Positions stay on the actors, since gameplay code moves actors directly all the time:
+// Integrate computes each body's displacement and then applies it to its owner.
+class RigidBodySystem
+{
+public:
+    RigidBodySystem();
+
+    // Returns the handle of the new body
+    int Add(class Actor* owner, float mass, float maxSpeedX, float maxSpeedY);
+    void Remove(int handle);
+
+    // Integrates the bodies whose owners are active, as RigidBodyComponent::Update used to
+    void Integrate(float deltaTime);
+
+    Vector2 GetVelocity(int handle) const { int i = mIndices[handle]; return Vector2(mVelocityX[i], mVelocityY[i]); }
+    void SetVelocity(int handle, const Vector2& velocity);
+
+    Vector2 GetAcceleration(int handle) const { int i = mIndices[handle]; return Vector2(mAccelerationX[i], mAccelerationY[i]); }
+    void SetAcceleration(int handle, const Vector2& acceleration);
+    void ApplyForce(int handle, const Vector2& force);
+
+    float GetAngularSpeed(int handle) const { return mAngularSpeed[mIndices[handle]]; }
+    void SetAngularSpeed(int handle, float speed) { mAngularSpeed[mIndices[handle]] = speed; }
+
+    float GetMaxSpeedX(int handle) const { return mMaxSpeedX[mIndices[handle]]; }
+    float GetMaxSpeedY(int handle) const { return mMaxSpeedY[mIndices[handle]]; }
+    void SetMaxSpeedX(int handle, float speed) { mMaxSpeedX[mIndices[handle]] = speed; }
+    void SetMaxSpeedY(int handle, float speed) { mMaxSpeedY[mIndices[handle]] = speed; }
+
+    // How much the owner moved in the last integration (used by swept collision)
+    Vector2 GetLastDisplacement(int handle) const { int i = mIndices[handle]; return Vector2(mDisplacementX[i], mDisplacementY[i]); }
+
+    int GetNumBodies() const { return static_cast<int>(mOwners.size()); }
+
+private:
+    // Handle -> array index, and array index -> handle
+    std::vector<int> mIndices;
+    std::vector<int> mHandles;
+    std::vector<int> mFreeHandles;
+
+    std::vector<class Actor*> mOwners;
+    // 1 when the owner is active this step (only active actors are updated)
+    std::vector<unsigned char> mIsActive;
+
+    std::vector<float> mVelocityX;
+    std::vector<float> mVelocityY;
+    std::vector<float> mAccelerationX;
+    std::vector<float> mAccelerationY;
+    std::vector<float> mInverseMass;
+    std::vector<float> mMaxSpeedX;
+    std::vector<float> mMaxSpeedY;
+    std::vector<float> mAngularSpeed;
+    std::vector<float> mDisplacementX;
+    std::vector<float> mDisplacementY;
+};
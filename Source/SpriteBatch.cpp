@@ -0,0 +1,126 @@
+#include "SpriteBatch.h"
+#include "Math.h"
+#include <utility>
+
+SpriteBatch::SpriteBatch(SDL_Renderer* renderer)
+    :mRenderer(renderer)
+    ,mLayer(0)
+    ,mNumBatches(0)
+{
+}
+
+int SpriteBatch::SetLayer(int layer)
+{
+    if (layer == mLayer) {
+        return 0;
+    }
+
+    mLayer = layer;
+    return Flush();
+}
+
+SpriteBatch::Batch& SpriteBatch::GetBatch(SDL_Texture* texture, SDL_BlendMode blendMode)
+{
+    // Poucas texturas por camada, busca linear basta
+    for (int i = 0; i < mNumBatches; i++) {
+        if (mBatches[i].mTexture == texture && mBatches[i].mBlendMode == blendMode) {
+            return mBatches[i];
+        }
+    }
+
+    if (mNumBatches == static_cast<int>(mBatches.size())) {
+        mBatches.emplace_back();
+    }
+
+    Batch& batch = mBatches[mNumBatches++];
+    batch.mTexture = texture;
+    batch.mBlendMode = blendMode;
+    batch.mVertices.clear();
+    batch.mIndices.clear();
+    return batch;
+}
+
+void SpriteBatch::Draw(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& dstRect, float angle,
+                       SDL_RendererFlip flip, SDL_Color color, SDL_BlendMode blendMode)
+{
+    if (!texture) {
+        return;
+    }
+
+    int textureWidth;
+    int textureHeight;
+    if (SDL_QueryTexture(texture, nullptr, nullptr, &textureWidth, &textureHeight) != 0 ||
+        textureWidth == 0 || textureHeight == 0)
+    {
+        return;
+    }
+
+    // Coordenadas de textura do retângulo de origem
+    SDL_Rect src = srcRect ? *srcRect : SDL_Rect{0, 0, textureWidth, textureHeight};
+    float u0 = static_cast<float>(src.x) / textureWidth;
+    float v0 = static_cast<float>(src.y) / textureHeight;
+    float u1 = static_cast<float>(src.x + src.w) / textureWidth;
+    float v1 = static_cast<float>(src.y + src.h) / textureHeight;
+    if (flip & SDL_FLIP_HORIZONTAL) {
+        std::swap(u0, u1);
+    }
+    if (flip & SDL_FLIP_VERTICAL) {
+        std::swap(v0, v1);
+    }
+
+    // Cantos relativos ao centro, girados como no SDL_RenderCopyEx
+    float halfWidth = dstRect.w * 0.5f;
+    float halfHeight = dstRect.h * 0.5f;
+    float centerX = dstRect.x + halfWidth;
+    float centerY = dstRect.y + halfHeight;
+
+    float cosAngle = 1.0f;
+    float sinAngle = 0.0f;
+    if (angle != 0.0f) {
+        float radians = Math::ToRadians(angle);
+        cosAngle = Math::Cos(radians);
+        sinAngle = Math::Sin(radians);
+    }
+
+    const float cornersX[4] = {-halfWidth, halfWidth, halfWidth, -halfWidth};
+    const float cornersY[4] = {-halfHeight, -halfHeight, halfHeight, halfHeight};
+    const float texCoordsU[4] = {u0, u1, u1, u0};
+    const float texCoordsV[4] = {v0, v0, v1, v1};
+
+    Batch& batch = GetBatch(texture, blendMode);
+    int firstVertex = static_cast<int>(batch.mVertices.size());
+    for (int i = 0; i < 4; i++) {
+        SDL_Vertex vertex;
+        vertex.position.x = centerX + cornersX[i] * cosAngle - cornersY[i] * sinAngle;
+        vertex.position.y = centerY + cornersX[i] * sinAngle + cornersY[i] * cosAngle;
+        vertex.color = color;
+        vertex.tex_coord.x = texCoordsU[i];
+        vertex.tex_coord.y = texCoordsV[i];
+        batch.mVertices.emplace_back(vertex);
+    }
+
+    const int quadIndices[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : quadIndices) {
+        batch.mIndices.emplace_back(firstVertex + index);
+    }
+}
+
+int SpriteBatch::Flush()
+{
+    int numDrawCalls = 0;
+    for (int i = 0; i < mNumBatches; i++) {
+        Batch& batch = mBatches[i];
+        if (batch.mIndices.empty()) {
+            continue;
+        }
+
+        // O SDL_RenderGeometry usa o blend mode da textura
+        SDL_SetTextureBlendMode(batch.mTexture, batch.mBlendMode);
+        SDL_RenderGeometry(mRenderer, batch.mTexture, batch.mVertices.data(), static_cast<int>(batch.mVertices.size()),
+                           batch.mIndices.data(), static_cast<int>(batch.mIndices.size()));
+        numDrawCalls++;
+    }
+
+    mNumBatches = 0;
+    return numDrawCalls;
+}
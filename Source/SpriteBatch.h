@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+#include <SDL.h>
+
+// Collects textured quads and draws them with one SDL_RenderGeometry call per texture and
+// blend mode. Tint and transparency go into the vertex colors, so no texture state changes
+// per sprite. Quads of the same layer (draw order) may be reordered by texture, as the draw
+// order is the only ordering drawables have; changing layer flushes the pending quads.
+// Anything drawn directly with the renderer must call Flush first.
+class SpriteBatch
+{
+public:
+    explicit SpriteBatch(SDL_Renderer* renderer);
+
+    // Flushes the pending quads if layer differs from the current one.
+    // Returns how many draw calls were issued
+    int SetLayer(int layer);
+
+    // Same parameters as SDL_RenderCopyEx: srcRect nullptr uses the whole texture, angle is
+    // in degrees clockwise around the center of dstRect. color multiplies the texture
+    void Draw(SDL_Texture* texture, const SDL_Rect* srcRect, const SDL_Rect& dstRect, float angle,
+              SDL_RendererFlip flip, SDL_Color color = SDL_Color{255, 255, 255, 255},
+              SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND);
+
+    // Draws the pending quads and returns how many draw calls were issued
+    int Flush();
+
+private:
+    struct Batch
+    {
+        SDL_Texture* mTexture;
+        SDL_BlendMode mBlendMode;
+        std::vector<SDL_Vertex> mVertices;
+        std::vector<int> mIndices;
+    };
+
+    Batch& GetBatch(SDL_Texture* texture, SDL_BlendMode blendMode);
+
+    SDL_Renderer* mRenderer;
+    int mLayer;
+
+    // Batches keep their buffers between frames; only the first mNumBatches are in use
+    std::vector<Batch> mBatches;
+    int mNumBatches;
+};
@@ -0,0 +1,61 @@
+#include "SpriteSheetAsset.h"
+#include "Json.h"
+#include <fstream>
+
+SpriteSheetAsset::SpriteSheetAsset()
+{
+}
+
+bool SpriteSheetAsset::Load(const std::string &dataPath)
+{
+    std::ifstream spriteSheetFile(dataPath);
+    if (!spriteSheetFile.is_open()) {
+        SDL_Log("Falha ao abrir sprite sheet: %s", dataPath.c_str());
+        return false;
+    }
+
+    nlohmann::json spriteSheetData = nlohmann::json::parse(spriteSheetFile, nullptr, false);
+    if (spriteSheetData.is_discarded() || !spriteSheetData.contains("frames")) {
+        SDL_Log("Sprite sheet inválido: %s", dataPath.c_str());
+        return false;
+    }
+
+    mDataPath = dataPath;
+    mFrames.clear();
+    mFrames.reserve(spriteSheetData["frames"].size());
+
+    for (const auto &frame: spriteSheetData["frames"]) {
+        SDL_Rect rect;
+        rect.x = frame["frame"]["x"].get<int>();
+        rect.y = frame["frame"]["y"].get<int>();
+        rect.w = frame["frame"]["w"].get<int>();
+        rect.h = frame["frame"]["h"].get<int>();
+        mFrames.emplace_back(rect);
+    }
+
+    return true;
+}
+
+int SpriteSheetAsset::RegisterClip(const std::string &name, const std::vector<int> &frameIndices)
+{
+    for (int i = 0; i < static_cast<int>(mClips.size()); i++) {
+        if (mClips[i].mName == name && mClips[i].mFrameIndices == frameIndices) {
+            return i;
+        }
+    }
+
+    AnimationClip clip;
+    clip.mName = name;
+    clip.mFrameIndices = frameIndices;
+    clip.mFrames.reserve(frameIndices.size());
+    for (int frameIndex : frameIndices) {
+        if (frameIndex < 0 || frameIndex >= static_cast<int>(mFrames.size())) {
+            SDL_Log("Animação %s usa frame %d inexistente em %s", name.c_str(), frameIndex, mDataPath.c_str());
+            return -1;
+        }
+        clip.mFrames.emplace_back(mFrames[frameIndex]);
+    }
+
+    mClips.emplace_back(clip);
+    return static_cast<int>(mClips.size()) - 1;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL.h>
+
+// Frame data of an Aseprite sprite sheet, parsed once per file and shared by every
+// DrawAnimatedComponent that uses it (see Game::LoadSpriteSheet). Frames are stored
+// contiguously and animation clips keep their frames already resolved to rects, so
+// drawing never goes through the JSON frame indices again.
+class SpriteSheetAsset
+{
+public:
+    struct AnimationClip
+    {
+        std::string mName;
+        std::vector<int> mFrameIndices;
+        std::vector<SDL_Rect> mFrames;
+    };
+
+    SpriteSheetAsset();
+
+    // Parses the "frames" array of the JSON at dataPath
+    bool Load(const std::string &dataPath);
+
+    // Returns the index of a clip with this name and frames, registering it the first
+    // time it is requested. Every instance of an actor registers the same clips, so
+    // after the first one this is only a lookup. Returns -1 if a frame is out of range.
+    int RegisterClip(const std::string &name, const std::vector<int> &frameIndices);
+
+    const AnimationClip& GetClip(int clipIndex) const { return mClips[clipIndex]; }
+    int GetNumClips() const { return static_cast<int>(mClips.size()); }
+
+    const SDL_Rect& GetFrame(int frameIndex) const { return mFrames[frameIndex]; }
+    int GetNumFrames() const { return static_cast<int>(mFrames.size()); }
+
+    const std::string& GetDataPath() const { return mDataPath; }
+
+private:
+    std::string mDataPath;
+
+    // All frames of the sprite sheet, in the order they appear in the JSON
+    std::vector<SDL_Rect> mFrames;
+
+    std::vector<AnimationClip> mClips;
+};
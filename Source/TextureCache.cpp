@@ -0,0 +1,173 @@
+#include "TextureCache.h"
+#include <SDL_image.h>
+#include <fstream>
+#include <vector>
+#include "Json.h"
+
+TextureCache::TextureCache(SDL_Renderer* renderer)
+    :mRenderer(renderer)
+    ,mTextureBytes(0)
+{
+}
+
+TextureCache::~TextureCache()
+{
+    Clear();
+}
+
+SDL_Texture* TextureCache::Acquire(const std::string& texturePath)
+{
+    auto iter = mTextures.find(texturePath);
+    if (iter != mTextures.end()) {
+        iter->second.mRefCount++;
+        return iter->second.mTexture;
+    }
+
+    // Textura ainda não carregada
+    SDL_Texture* texture = LoadFromFile(texturePath);
+    if (!texture) {
+        return nullptr;
+    }
+
+    TextureEntry entry;
+    entry.mTexture = texture;
+    entry.mRefCount = 1;
+
+    // Estimativa: as texturas carregadas de PNG ficam em 4 bytes por pixel
+    int width = 0, height = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+    entry.mBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+    mTextureBytes += entry.mBytes;
+
+    mTextures.emplace(texturePath, entry);
+    mTexturePaths.emplace(texture, texturePath);
+    return texture;
+}
+
+SDL_Texture* TextureCache::AcquireRegion(const std::string& texturePath, SDL_Rect& region)
+{
+    auto regionIter = mAtlasRegions.find(texturePath);
+    if (regionIter != mAtlasRegions.end()) {
+        SDL_Texture* page = Acquire(regionIter->second.mPagePath);
+        if (page) {
+            region = regionIter->second.mRect;
+            return page;
+        }
+        // Página não carregou, usa o arquivo original
+    }
+
+    SDL_Texture* texture = Acquire(texturePath);
+    region = SDL_Rect{0, 0, 0, 0};
+    if (texture) {
+        SDL_QueryTexture(texture, nullptr, nullptr, &region.w, &region.h);
+    }
+    return texture;
+}
+
+bool TextureCache::LoadAtlas(const std::string& manifestPath, const std::string& assetRoot)
+{
+    std::ifstream manifestFile(manifestPath);
+    if (!manifestFile.is_open()) {
+        SDL_Log("Atlas %s não encontrado, usando as imagens separadas", manifestPath.c_str());
+        return false;
+    }
+
+    nlohmann::json manifest = nlohmann::json::parse(manifestFile, nullptr, false);
+    if (manifest.is_discarded() || !manifest.contains("pages") || !manifest.contains("images")) {
+        SDL_Log("Manifesto de atlas inválido: %s", manifestPath.c_str());
+        return false;
+    }
+
+    // Páginas ficam na mesma pasta do manifesto
+    size_t slashPos = manifestPath.find_last_of('/');
+    std::string manifestDir = slashPos == std::string::npos ? "" : manifestPath.substr(0, slashPos + 1);
+
+    std::vector<std::string> pagePaths;
+    for (const auto& page : manifest["pages"]) {
+        pagePaths.emplace_back(manifestDir + page.get<std::string>());
+    }
+
+    for (const auto& image : manifest["images"]) {
+        int page = image["page"].get<int>();
+        if (page < 0 || page >= static_cast<int>(pagePaths.size())) {
+            SDL_Log("Imagem com página inválida no atlas %s", manifestPath.c_str());
+            continue;
+        }
+
+        AtlasRegion atlasRegion;
+        atlasRegion.mPagePath = pagePaths[page];
+        atlasRegion.mRect = SDL_Rect{image["x"].get<int>(), image["y"].get<int>(),
+                                     image["w"].get<int>(), image["h"].get<int>()};
+        mAtlasRegions[assetRoot + image["path"].get<std::string>()] = atlasRegion;
+    }
+
+    SDL_Log("Atlas %s: %d imagens em %d páginas", manifestPath.c_str(),
+            static_cast<int>(mAtlasRegions.size()), static_cast<int>(pagePaths.size()));
+    return true;
+}
+
+void TextureCache::Release(SDL_Texture* texture)
+{
+    if (!texture) {
+        return;
+    }
+
+    auto pathIter = mTexturePaths.find(texture);
+    if (pathIter == mTexturePaths.end()) {
+        SDL_Log("TextureCache: Release de uma textura que não pertence ao cache.");
+        return;
+    }
+
+    TextureEntry& entry = mTextures[pathIter->second];
+    if (entry.mRefCount > 0) {
+        entry.mRefCount--;
+    }
+}
+
+void TextureCache::EvictUnused()
+{
+    auto iter = mTextures.begin();
+    while (iter != mTextures.end()) {
+        if (iter->second.mRefCount <= 0) {
+            mTextureBytes -= iter->second.mBytes;
+            mTexturePaths.erase(iter->second.mTexture);
+            SDL_DestroyTexture(iter->second.mTexture);
+            iter = mTextures.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+void TextureCache::Clear()
+{
+    for (auto& pair : mTextures) {
+        if (pair.second.mTexture) {
+            SDL_DestroyTexture(pair.second.mTexture);
+        }
+    }
+    mTextures.clear();
+    mTexturePaths.clear();
+    mTextureBytes = 0;
+}
+
+SDL_Texture* TextureCache::LoadFromFile(const std::string& texturePath)
+{
+    SDL_Surface* surface = IMG_Load(texturePath.c_str());
+    if (!surface)
+    {
+        SDL_Log("Falha ao carregar imagem %s: %s", texturePath.c_str(), IMG_GetError());
+        return nullptr;
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(mRenderer, surface);
+    SDL_FreeSurface(surface); // Libera a superfície, já não é mais necessária
+
+    if (!texture)
+    {
+        SDL_Log("Falha ao criar textura a partir de %s: %s", texturePath.c_str(), SDL_GetError());
+        return nullptr;
+    }
+    return texture;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <SDL.h>
+
+// Shares SDL_Textures loaded from disk between everyone that asks for the same path.
+// Each Acquire must be paired with a Release; textures whose reference count drops
+// to zero stay resident until EvictUnused is called (normally after a scene change),
+// so a texture released by the old scene and requested again by the new one is
+// never decoded twice.
+// If an atlas manifest (written by the atlas-packer tool) is loaded, AcquireRegion serves
+// packed images from the shared atlas pages, so sprites of different actors share textures.
+class TextureCache
+{
+public:
+    TextureCache(SDL_Renderer* renderer);
+    ~TextureCache();
+
+    // Returns the texture for the given path, loading it if needed, and increments
+    // its reference count. Returns nullptr if the file could not be loaded.
+    SDL_Texture* Acquire(const std::string& texturePath);
+
+    // Like Acquire, but returns the atlas page that holds the image when it was packed.
+    // region receives the area of the returned texture with the image (the whole texture
+    // if it is not in an atlas). Release the returned texture as usual
+    SDL_Texture* AcquireRegion(const std::string& texturePath, SDL_Rect& region);
+
+    // Decrements the reference count of a texture returned by Acquire or AcquireRegion
+    void Release(SDL_Texture* texture);
+
+    // Reads an atlas manifest. Image paths in the manifest are relative to the packed
+    // directory, and assetRoot is prepended to match the paths the game asks for
+    bool LoadAtlas(const std::string& manifestPath, const std::string& assetRoot);
+
+    // Destroys every texture that is no longer referenced
+    void EvictUnused();
+
+    // Destroys every texture, referenced or not
+    void Clear();
+
+    int GetNumTextures() const { return static_cast<int>(mTextures.size()); }
+    // Estimated memory used by the cached textures
+    size_t GetTextureBytes() const { return mTextureBytes; }
+
+private:
+    SDL_Texture* LoadFromFile(const std::string& texturePath);
+
+    struct TextureEntry
+    {
+        SDL_Texture* mTexture = nullptr;
+        int mRefCount = 0;
+        size_t mBytes = 0;
+    };
+
+    // Where a packed image lives: page path and area of the page
+    struct AtlasRegion
+    {
+        std::string mPagePath;
+        SDL_Rect mRect;
+    };
+
+    SDL_Renderer* mRenderer;
+
+    size_t mTextureBytes;
+
+    // Path -> loaded texture
+    std::unordered_map<std::string, TextureEntry> mTextures;
+
+    // Texture -> path, used to find the entry on Release
+    std::unordered_map<SDL_Texture*, std::string> mTexturePaths;
+
+    // Image path -> atlas region, empty when no atlas is loaded
+    std::unordered_map<std::string, AtlasRegion> mAtlasRegions;
+};
@@ -0,0 +1,223 @@
+#include "TileChunkLayer.h"
+#include <cmath>
+
+TileChunkLayer::TileChunkLayer(SDL_Renderer* renderer)
+    :mRenderer(renderer)
+    ,mIsEnabled(false)
+    ,mWidth(0)
+    ,mHeight(0)
+    ,mTileSize(1)
+    ,mChunkTiles(CHUNK_TILES)
+    ,mChunkCols(0)
+    ,mChunkRows(0)
+    ,mMaxTextureSize(0)
+{
+    SDL_RendererInfo rendererInfo;
+    if (mRenderer && SDL_GetRendererInfo(mRenderer, &rendererInfo) == 0) {
+        mIsEnabled = (rendererInfo.flags & SDL_RENDERER_TARGETTEXTURE) != 0;
+        mMaxTextureSize = Math::Min(rendererInfo.max_texture_width, rendererInfo.max_texture_height);
+    }
+
+    if (mRenderer && !mIsEnabled) {
+        SDL_Log("Renderer sem suporte a render targets, tiles serão desenhados um a um");
+    }
+}
+
+TileChunkLayer::~TileChunkLayer()
+{
+    FreeChunks();
+}
+
+void TileChunkLayer::FreeChunks()
+{
+    for (Chunk& chunk : mChunks) {
+        if (chunk.mTexture) {
+            SDL_DestroyTexture(chunk.mTexture);
+        }
+    }
+    mChunks.clear();
+}
+
+void TileChunkLayer::Reset(int width, int height, int tileSize)
+{
+    FreeChunks();
+
+    mWidth = width > 0 ? width : 0;
+    mHeight = height > 0 ? height : 0;
+    mTileSize = tileSize > 0 ? tileSize : 1;
+
+    // Diminui o chunk se a textura passar do limite do renderer (0 = sem limite)
+    mChunkTiles = CHUNK_TILES;
+    if (mMaxTextureSize > 0) {
+        mChunkTiles = Math::Max(1, Math::Min(CHUNK_TILES, mMaxTextureSize / mTileSize));
+    }
+
+    mChunkCols = (mWidth + mChunkTiles - 1) / mChunkTiles;
+    mChunkRows = (mHeight + mChunkTiles - 1) / mChunkTiles;
+
+    mTiles.assign(mWidth * mHeight, -1);
+    mChunks.assign(mChunkCols * mChunkRows, Chunk{nullptr, false, 0});
+}
+
+void TileChunkLayer::SetTile(int col, int row, int tileIndex)
+{
+    if (col < 0 || row < 0 || col >= mWidth || row >= mHeight) {
+        return;
+    }
+
+    int& tile = mTiles[row * mWidth + col];
+    if (tile == tileIndex) {
+        return;
+    }
+
+    Chunk& chunk = GetChunk(col, row);
+    if (tile < 0) {
+        chunk.mNumTiles++;
+    }
+    else if (tileIndex < 0) {
+        chunk.mNumTiles--;
+    }
+    tile = tileIndex;
+    chunk.mIsDirty = true;
+}
+
+void TileChunkLayer::ClearRect(const Vector2& min, const Vector2& max)
+{
+    // Mesma regra da camada de colisão: a borda final não conta
+    float tileSize = static_cast<float>(mTileSize);
+    int minCol = static_cast<int>(std::floor(min.x / tileSize + 0.01f));
+    int minRow = static_cast<int>(std::floor(min.y / tileSize + 0.01f));
+    int maxCol = static_cast<int>(std::ceil(max.x / tileSize - 0.01f)) - 1;
+    int maxRow = static_cast<int>(std::ceil(max.y / tileSize - 0.01f)) - 1;
+
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            SetTile(col, row, -1);
+        }
+    }
+}
+
+void TileChunkLayer::Invalidate()
+{
+    for (Chunk& chunk : mChunks) {
+        chunk.mIsDirty = true;
+    }
+}
+
+void TileChunkLayer::Bake(SDL_Texture* tileSheet, const std::unordered_map<int, SDL_Rect>& tileSheetData)
+{
+    if (!mIsEnabled) {
+        return;
+    }
+
+    for (int chunkRow = 0; chunkRow < mChunkRows; chunkRow++) {
+        for (int chunkCol = 0; chunkCol < mChunkCols; chunkCol++) {
+            if (mChunks[chunkRow * mChunkCols + chunkCol].mIsDirty) {
+                BakeChunk(chunkCol, chunkRow, tileSheet, tileSheetData);
+            }
+        }
+    }
+}
+
+void TileChunkLayer::BakeChunk(int chunkCol, int chunkRow, SDL_Texture* tileSheet,
+                               const std::unordered_map<int, SDL_Rect>& tileSheetData)
+{
+    Chunk& chunk = mChunks[chunkRow * mChunkCols + chunkCol];
+    chunk.mIsDirty = false;
+
+    // Chunk vazio não precisa de textura
+    if (chunk.mNumTiles == 0) {
+        if (chunk.mTexture) {
+            SDL_DestroyTexture(chunk.mTexture);
+            chunk.mTexture = nullptr;
+        }
+        return;
+    }
+
+    int chunkSize = mChunkTiles * mTileSize;
+    if (!chunk.mTexture) {
+        chunk.mTexture = SDL_CreateTexture(mRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                           chunkSize, chunkSize);
+        if (!chunk.mTexture) {
+            SDL_Log("Falha ao criar textura do chunk (%d, %d): %s", chunkCol, chunkRow, SDL_GetError());
+            return;
+        }
+        SDL_SetTextureBlendMode(chunk.mTexture, SDL_BLENDMODE_BLEND);
+    }
+
+    // O chunk pode ser refeito no meio do quadro: guarda o estado de desenho para restaurar
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(mRenderer);
+    SDL_BlendMode previousBlendMode;
+    SDL_GetRenderDrawBlendMode(mRenderer, &previousBlendMode);
+    Uint8 previousR, previousG, previousB, previousA;
+    SDL_GetRenderDrawColor(mRenderer, &previousR, &previousG, &previousB, &previousA);
+    SDL_SetRenderTarget(mRenderer, chunk.mTexture);
+
+    // Fundo transparente para o parallax aparecer entre os tiles
+    SDL_SetRenderDrawBlendMode(mRenderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 0);
+    SDL_RenderClear(mRenderer);
+
+    int firstCol = chunkCol * mChunkTiles;
+    int firstRow = chunkRow * mChunkTiles;
+    int lastCol = Math::Min(firstCol + mChunkTiles, mWidth);
+    int lastRow = Math::Min(firstRow + mChunkTiles, mHeight);
+    for (int row = firstRow; row < lastRow; row++) {
+        for (int col = firstCol; col < lastCol; col++) {
+            int tile = mTiles[row * mWidth + col];
+            if (tile < 0) {
+                continue;
+            }
+
+            auto iter = tileSheetData.find(tile);
+            if (iter == tileSheetData.end()) {
+                continue;
+            }
+
+            SDL_Rect region = {(col - firstCol) * mTileSize, (row - firstRow) * mTileSize, mTileSize, mTileSize};
+            SDL_RenderCopy(mRenderer, tileSheet, &iter->second, &region);
+        }
+    }
+
+    SDL_SetRenderTarget(mRenderer, previousTarget);
+    SDL_SetRenderDrawBlendMode(mRenderer, previousBlendMode);
+    SDL_SetRenderDrawColor(mRenderer, previousR, previousG, previousB, previousA);
+}
+
+int TileChunkLayer::Draw(const Vector2& cameraPos, float viewWidth, float viewHeight,
+                         SDL_Texture* tileSheet, const std::unordered_map<int, SDL_Rect>& tileSheetData)
+{
+    if (!mIsEnabled || mChunks.empty()) {
+        return 0;
+    }
+
+    // Chunks que encostam na view
+    float chunkSize = static_cast<float>(mChunkTiles * mTileSize);
+    int minChunkCol = Math::Max(static_cast<int>(std::floor(cameraPos.x / chunkSize)), 0);
+    int minChunkRow = Math::Max(static_cast<int>(std::floor(cameraPos.y / chunkSize)), 0);
+    int maxChunkCol = Math::Min(static_cast<int>(std::floor((cameraPos.x + viewWidth) / chunkSize)), mChunkCols - 1);
+    int maxChunkRow = Math::Min(static_cast<int>(std::floor((cameraPos.y + viewHeight) / chunkSize)), mChunkRows - 1);
+
+    int numDrawn = 0;
+    for (int chunkRow = minChunkRow; chunkRow <= maxChunkRow; chunkRow++) {
+        for (int chunkCol = minChunkCol; chunkCol <= maxChunkCol; chunkCol++) {
+            Chunk& chunk = mChunks[chunkRow * mChunkCols + chunkCol];
+            if (chunk.mIsDirty) {
+                BakeChunk(chunkCol, chunkRow, tileSheet, tileSheetData);
+            }
+            if (!chunk.mTexture) {
+                continue;
+            }
+
+            SDL_Rect region;
+            region.x = static_cast<int>(chunkCol * chunkSize - cameraPos.x);
+            region.y = static_cast<int>(chunkRow * chunkSize - cameraPos.y);
+            region.w = static_cast<int>(chunkSize);
+            region.h = static_cast<int>(chunkSize);
+            SDL_RenderCopy(mRenderer, chunk.mTexture, nullptr, &region);
+            numDrawn++;
+        }
+    }
+
+    return numDrawn;
+}
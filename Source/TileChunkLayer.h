@@ -0,0 +1,69 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include <SDL.h>
+#include "Math.h"
+
+// Static tiles of the level pre-rendered into chunk textures of CHUNK_TILES x CHUNK_TILES tiles
+// (1024x1024 pixels for 32 pixel tiles), so the whole static layer costs one copy per visible
+// chunk instead of one copy per tile. Tiles are set in tile coordinates (same grid as
+// Game::mLevelData) and chunks are baked again only when their tiles change, when the renderer
+// loses its targets or when the layer is reset (e.g. on a resolution change).
+// The layer is disabled if the renderer does not support render targets.
+class TileChunkLayer
+{
+public:
+    static const int CHUNK_TILES = 32;
+
+    explicit TileChunkLayer(SDL_Renderer* renderer);
+    ~TileChunkLayer();
+
+    // Frees all chunks and resizes the layer to width x height tiles of tileSize pixels
+    void Reset(int width, int height, int tileSize);
+
+    void SetTile(int col, int row, int tileIndex);
+    // Removes the tiles covered by the world rectangle (min, max)
+    void ClearRect(const Vector2& min, const Vector2& max);
+
+    // Bakes every chunk that changed since it was last baked
+    void Bake(SDL_Texture* tileSheet, const std::unordered_map<int, SDL_Rect>& tileSheetData);
+    // Marks every chunk to be baked again (render targets are lost on device reset)
+    void Invalidate();
+
+    // Draws the chunks that overlap the view and returns how many were drawn
+    int Draw(const Vector2& cameraPos, float viewWidth, float viewHeight,
+             SDL_Texture* tileSheet, const std::unordered_map<int, SDL_Rect>& tileSheetData);
+
+    bool IsEnabled() const { return mIsEnabled; }
+
+private:
+    struct Chunk
+    {
+        SDL_Texture* mTexture;
+        bool mIsDirty;
+        int mNumTiles;
+    };
+
+    void BakeChunk(int chunkCol, int chunkRow, SDL_Texture* tileSheet,
+                   const std::unordered_map<int, SDL_Rect>& tileSheetData);
+    void FreeChunks();
+    Chunk& GetChunk(int col, int row) { return mChunks[(row / mChunkTiles) * mChunkCols + col / mChunkTiles]; }
+
+    SDL_Renderer* mRenderer;
+    bool mIsEnabled;
+
+    int mWidth;
+    int mHeight;
+    int mTileSize;
+
+    // Tiles per chunk side, smaller than CHUNK_TILES if the texture would exceed the renderer limit
+    int mChunkTiles;
+    int mChunkCols;
+    int mChunkRows;
+    int mMaxTextureSize;
+
+    // Tile index of each tile (row-major), -1 when empty
+    std::vector<int> mTiles;
+    std::vector<Chunk> mChunks;
+};
@@ -0,0 +1,141 @@
+#include "TileCollisionLayer.h"
+#include "Components/AABBComponent.h"
+#include <cmath>
+
+TileCollisionLayer::TileCollisionLayer()
+    :mWidth(0)
+    ,mHeight(0)
+    ,mTileSize(1.0f)
+{
+}
+
+void TileCollisionLayer::Reset(int width, int height, float tileSize)
+{
+    mWidth = width > 0 ? width : 0;
+    mHeight = height > 0 ? height : 0;
+    mTileSize = tileSize > 0.0f ? tileSize : 1.0f;
+
+    mSolidCount.assign(mWidth * mHeight, 0);
+    mSpikeCount.assign(mWidth * mHeight, 0);
+}
+
+void TileCollisionLayer::AddRect(const Vector2& min, const Vector2& max, bool isSpike)
+{
+    ChangeRect(min, max, isSpike, 1);
+}
+
+void TileCollisionLayer::RemoveRect(const Vector2& min, const Vector2& max, bool isSpike)
+{
+    ChangeRect(min, max, isSpike, -1);
+}
+
+void TileCollisionLayer::ChangeRect(const Vector2& min, const Vector2& max, bool isSpike, int delta)
+{
+    if (max.x <= min.x || max.y <= min.y) {
+        return;
+    }
+
+    // Tiles cobertos pelo interior do retângulo (a borda final não conta)
+    int minCol = static_cast<int>(std::floor(min.x / mTileSize + 0.01f));
+    int minRow = static_cast<int>(std::floor(min.y / mTileSize + 0.01f));
+    int maxCol = static_cast<int>(std::ceil(max.x / mTileSize - 0.01f)) - 1;
+    int maxRow = static_cast<int>(std::ceil(max.y / mTileSize - 0.01f)) - 1;
+
+    minCol = Math::Max(minCol, 0);
+    minRow = Math::Max(minRow, 0);
+    maxCol = Math::Min(maxCol, mWidth - 1);
+    maxRow = Math::Min(maxRow, mHeight - 1);
+
+    std::vector<unsigned char>& counts = isSpike ? mSpikeCount : mSolidCount;
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            unsigned char& count = counts[row * mWidth + col];
+            if (delta > 0 && count < 255) {
+                count++;
+            }
+            else if (delta < 0 && count > 0) {
+                count--;
+            }
+        }
+    }
+}
+
+bool TileCollisionLayer::IsSolidTile(int col, int row, bool includeSpikes) const
+{
+    if (col < 0 || row < 0 || col >= mWidth || row >= mHeight) {
+        return false;
+    }
+
+    int index = row * mWidth + col;
+    return mSolidCount[index] > 0 || (includeSpikes && mSpikeCount[index] > 0);
+}
+
+bool TileCollisionLayer::IsSolidAt(const Vector2& point, bool includeSpikes) const
+{
+    int col = static_cast<int>(std::floor(point.x / mTileSize));
+    int row = static_cast<int>(std::floor(point.y / mTileSize));
+    return IsSolidTile(col, row, includeSpikes);
+}
+
+bool TileCollisionLayer::Overlaps(const Vector2& min, const Vector2& max, bool includeSpikes) const
+{
+    int minCol = Math::Max(static_cast<int>(std::floor(min.x / mTileSize)), 0);
+    int minRow = Math::Max(static_cast<int>(std::floor(min.y / mTileSize)), 0);
+    int maxCol = Math::Min(static_cast<int>(std::floor(max.x / mTileSize)), mWidth - 1);
+    int maxRow = Math::Min(static_cast<int>(std::floor(max.y / mTileSize)), mHeight - 1);
+
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            if (IsSolidTile(col, row, includeSpikes)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool TileCollisionLayer::Sweep(const Vector2& min, const Vector2& max, const Vector2& displacement,
+                               float& t, Vector2& normal, bool includeSpikes) const
+{
+    // Região varrida pela caixa do início ao fim do movimento
+    Vector2 sweptMin(Math::Min(min.x, min.x + displacement.x), Math::Min(min.y, min.y + displacement.y));
+    Vector2 sweptMax(Math::Max(max.x, max.x + displacement.x), Math::Max(max.y, max.y + displacement.y));
+
+    int minCol = Math::Max(static_cast<int>(std::floor(sweptMin.x / mTileSize)), 0);
+    int minRow = Math::Max(static_cast<int>(std::floor(sweptMin.y / mTileSize)), 0);
+    int maxCol = Math::Min(static_cast<int>(std::floor(sweptMax.x / mTileSize)), mWidth - 1);
+    int maxRow = Math::Min(static_cast<int>(std::floor(sweptMax.y / mTileSize)), mHeight - 1);
+
+    bool hit = false;
+    t = 1.0f;
+    normal = Vector2::Zero;
+
+    for (int row = minRow; row <= maxRow; row++) {
+        for (int col = minCol; col <= maxCol; col++) {
+            if (!IsSolidTile(col, row, includeSpikes)) {
+                continue;
+            }
+
+            Vector2 tileMin(col * mTileSize, row * mTileSize);
+            Vector2 tileMax(tileMin.x + mTileSize, tileMin.y + mTileSize);
+
+            float tileToi;
+            Vector2 tileNormal;
+            if (!AABBComponent::SweepBoxes(min, max, displacement, tileMin, tileMax, tileToi, tileNormal)) {
+                continue;
+            }
+
+            if (!hit || tileToi < t) {
+                hit = true;
+                t = tileToi;
+                normal = tileNormal;
+                if (t <= 0.0f) {
+                    // Já começou sobreposta a este tile
+                    return true;
+                }
+            }
+        }
+    }
+
+    return hit;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+#include "Math.h"
+
+// Static collision of the level rasterized into the tile grid (same size as Game::mLevelData).
+// Each tile counts how many solid and spike rectangles cover it, so static Grounds can be
+// added and removed again if they start moving. Queries only visit the tiles they touch.
+// Ground rectangles are expected to be aligned to the tile grid, as they are in Tiled.
+class TileCollisionLayer
+{
+public:
+    TileCollisionLayer();
+
+    // Clears the layer and resizes it to width x height tiles
+    void Reset(int width, int height, float tileSize);
+
+    void AddRect(const Vector2& min, const Vector2& max, bool isSpike);
+    void RemoveRect(const Vector2& min, const Vector2& max, bool isSpike);
+
+    // Whether the point is inside a solid tile
+    bool IsSolidAt(const Vector2& point, bool includeSpikes = true) const;
+
+    // Whether the box (min, max) touches any solid tile
+    bool Overlaps(const Vector2& min, const Vector2& max, bool includeSpikes = true) const;
+
+    // Moves the box (min, max) by displacement and returns true if it hits a solid tile on the way.
+    // t receives the fraction of displacement travelled before the hit and normal the side that was hit
+    bool Sweep(const Vector2& min, const Vector2& max, const Vector2& displacement,
+               float& t, Vector2& normal, bool includeSpikes = true) const;
+
+    float GetTileSize() const { return mTileSize; }
+
+private:
+    void ChangeRect(const Vector2& min, const Vector2& max, bool isSpike, int delta);
+    bool IsSolidTile(int col, int row, bool includeSpikes) const;
+
+    int mWidth;
+    int mHeight;
+    float mTileSize;
+
+    // Number of rectangles covering each tile (row-major)
+    std::vector<unsigned char> mSolidCount;
+    std::vector<unsigned char> mSpikeCount;
+};
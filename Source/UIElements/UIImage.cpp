@@ -3,44 +3,39 @@
 //
 
 #include "UIImage.h"
+#include "../Game.h"
 
-UIImage::UIImage(const std::string &imagePath, const Vector2 &pos, const Vector2 &size, const Vector3 &color, SDL_Renderer* renderer)
+UIImage::UIImage(const std::string &imagePath, const Vector2 &pos, const Vector2 &size, const Vector3 &color, Game* game)
     :UIElement(pos, size, color)
     ,mTexture(nullptr)
-    ,mRenderer(renderer)
+    ,mGame(game)
 {
-    SDL_Surface* surface = IMG_Load(imagePath.c_str());
-
-    if (!surface) {
-        SDL_Log("Failed to load image: %s", IMG_GetError());
-    }
-    mTexture = SDL_CreateTextureFromSurface(mRenderer, surface);
-    SDL_FreeSurface(surface);
+    mImagePath = imagePath;
+    mTexture = mGame->LoadTexture(imagePath, mTextureRegion);
 }
 
 UIImage::~UIImage()
 {
     if (mTexture) {
-        SDL_DestroyTexture(mTexture);
+        mGame->ReleaseTexture(mTexture);
         mTexture = nullptr;
     }
 }
 
 void UIImage::SetImage(const std::string& imagePath)
 {
-    if (mTexture != nullptr) {
-        SDL_DestroyTexture(mTexture);
-        mTexture = nullptr;
+    // HUD chama isso todo frame, então só troca se a imagem mudou
+    if (imagePath == mImagePath && mTexture != nullptr) {
+        return;
     }
 
-    SDL_Surface* surface = IMG_Load(imagePath.c_str());
-
-    if (!surface) {
-        SDL_Log("Failed to load image: %s", IMG_GetError());
+    if (mTexture != nullptr) {
+        mGame->ReleaseTexture(mTexture);
+        mTexture = nullptr;
     }
 
-    mTexture = SDL_CreateTextureFromSurface(mRenderer, surface);
-    SDL_FreeSurface(surface);
+    mImagePath = imagePath;
+    mTexture = mGame->LoadTexture(imagePath, mTextureRegion);
 }
 
 void UIImage::Draw(SDL_Renderer* renderer, const Vector2 &screenPos)
@@ -55,7 +50,7 @@ void UIImage::Draw(SDL_Renderer* renderer, const Vector2 &screenPos)
     dstRect.w = mSize.x;
     dstRect.h = mSize.y;
 
-    SDL_RenderCopyEx(renderer, mTexture, nullptr, &dstRect, 0.0, nullptr, SDL_FLIP_NONE);
+    SDL_RenderCopyEx(renderer, mTexture, &mTextureRegion, &dstRect, 0.0, nullptr, SDL_FLIP_NONE);
 }
 
 void UIImage::ChangeResolution(float oldScale, float newScale) {
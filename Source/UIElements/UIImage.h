@@ -12,7 +12,7 @@ class UIImage : public UIElement
 {
 public:
     UIImage(const std::string& imagePath, const Vector2 &pos = Vector2::Zero,
-            const Vector2 &size = Vector2(100.f, 100.f), const Vector3 &color = Color::White, SDL_Renderer* renderer = nullptr);
+            const Vector2 &size = Vector2(100.f, 100.f), const Vector3 &color = Color::White, class Game* game = nullptr);
 
     ~UIImage();
 
@@ -22,6 +22,8 @@ public:
     void ChangeResolution(float oldScale, float newScale) override;
 
 private:
-    SDL_Texture* mTexture; // Texture for the image
-    SDL_Renderer* mRenderer;
+    SDL_Texture* mTexture; // Texture for the image (owned by the game's texture cache)
+    SDL_Rect mTextureRegion; // Area of mTexture with the image (a region of an atlas page when packed)
+    std::string mImagePath;
+    class Game* mGame;
 };
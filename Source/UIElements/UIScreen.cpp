@@ -2,7 +2,7 @@
 #include "../Game.h"
 #include "UIFont.h"
 
-UIScreen::UIScreen(Game* game, const std::string& fontName)
+UIScreen::UIScreen(Game* game, const std::string& fontName, bool pushToUIStack)
 	:mGame(game)
 	,mPos(0.f, 0.f)
 	,mSize(0.f, 0.f)
@@ -10,7 +10,9 @@ UIScreen::UIScreen(Game* game, const std::string& fontName)
     ,mIsVisible(true)
     ,mSelectedButtonIndex(-1)
 {
-    mGame->PushUI(this);
+    if (pushToUIStack) {
+        mGame->PushUI(this);
+    }
 
     mFont = mGame->LoadFont(fontName);
 }
@@ -156,7 +158,7 @@ UIButton* UIScreen::AddButton(const std::string& name, const Vector2 &pos, const
 
 UIImage* UIScreen::AddImage(const std::string &imagePath, const Vector2 &pos, const Vector2 &dims, const Vector3 &color)
 {
-    UIImage* img = new UIImage(imagePath, pos, dims, color, mGame->GetRenderer());
+    UIImage* img = new UIImage(imagePath, pos, dims, color, mGame);
 
     mImages.emplace_back(img);
 
@@ -19,7 +19,9 @@ public:
         Closing
     };
 
-	UIScreen(class Game* game, const std::string& fontName);
+	// Screens that are not pushed to the game's UI stack (e.g. overlays) don't receive
+	// input and must be updated, drawn and deleted by their owner
+	UIScreen(class Game* game, const std::string& fontName, bool pushToUIStack = true);
 	virtual ~UIScreen();
 
 	// UIScreen subclasses can override these
@@ -41,6 +43,7 @@ public:
 	UIState GetState() const { return mState; }
 
 	void SetIsVisible(bool isVisible) { mIsVisible = isVisible; }
+	bool IsVisible() const { return mIsVisible; }
 
     // Game getter
     class Game* GetGame() const { return mGame; }
@@ -33,7 +33,8 @@ void UIText::SetText(const std::string &text)
     mTextTexture = mFont->RenderText(text, mColor, mPointSize, mWrapLength);
     mText = text;
 
-    int texWidth, texHeight;
+    // Sem renderer (modo headless) não há textura e o tamanho fica zero
+    int texWidth = 0, texHeight = 0;
     SDL_QueryTexture(mTextTexture, nullptr, nullptr, &texWidth, &texHeight);
     SetSize(Vector2(texWidth, texHeight));
 }
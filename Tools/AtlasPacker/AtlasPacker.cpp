@@ -0,0 +1,231 @@
+// Offline texture atlas packer.
+//
+// Usage: atlas-packer <assetsDir> <outputDir> <subdir>... [--page-size N] [--max-image N]
+//
+// Packs every PNG found under <assetsDir>/<subdir> into pages of N x N pixels and writes
+// Atlas0.png, Atlas1.png, ... plus the manifest Atlas.json to <outputDir>. Image paths in
+// the manifest are relative to <assetsDir>, which is how TextureCache::LoadAtlas maps them
+// back to the paths the game asks for. Images larger than --max-image are left out and
+// keep being loaded from their own files.
+
+#define SDL_MAIN_HANDLED
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include <SDL_image.h>
+#include "Json.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Espaço entre imagens para o filtro não misturar vizinhas
+    const int PADDING = 2;
+
+    struct Image
+    {
+        std::string mPath;
+        SDL_Surface* mSurface;
+        int mPage;
+        int mX;
+        int mY;
+    };
+
+    // Prateleira aberta de uma página: imagens lado a lado na mesma faixa de altura
+    struct Shelf
+    {
+        int mY;
+        int mHeight;
+        int mNextX;
+    };
+
+    struct Page
+    {
+        std::vector<Shelf> mShelves;
+        int mNextShelfY;
+    };
+
+    bool PlaceImage(Page& page, Image& image, int pageSize)
+    {
+        int width = image.mSurface->w + PADDING;
+        int height = image.mSurface->h + PADDING;
+
+        // Primeiro tenta uma prateleira existente com altura suficiente
+        for (Shelf& shelf : page.mShelves) {
+            if (height <= shelf.mHeight && shelf.mNextX + width <= pageSize) {
+                image.mX = shelf.mNextX;
+                image.mY = shelf.mY;
+                shelf.mNextX += width;
+                return true;
+            }
+        }
+
+        if (page.mNextShelfY + height > pageSize || width > pageSize) {
+            return false;
+        }
+
+        page.mShelves.emplace_back(Shelf{page.mNextShelfY, height, width});
+        image.mX = 0;
+        image.mY = page.mNextShelfY;
+        page.mNextShelfY += height;
+        return true;
+    }
+
+    void PrintUsage()
+    {
+        SDL_Log("Uso: atlas-packer <assetsDir> <outputDir> <subdir>... [--page-size N] [--max-image N]");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int pageSize = 2048;
+    int maxImageSize = 1024;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--page-size" && i + 1 < argc) {
+            pageSize = std::stoi(argv[++i]);
+        }
+        else if (arg == "--max-image" && i + 1 < argc) {
+            maxImageSize = std::stoi(argv[++i]);
+        }
+        else {
+            positional.emplace_back(arg);
+        }
+    }
+
+    if (positional.size() < 3 || pageSize <= 0 || maxImageSize <= 0) {
+        PrintUsage();
+        return 1;
+    }
+    maxImageSize = std::min(maxImageSize, pageSize - PADDING);
+
+    fs::path assetsDir = positional[0];
+    fs::path outputDir = positional[1];
+
+    if (IMG_Init(IMG_INIT_PNG) == 0) {
+        SDL_Log("Falha ao inicializar SDL_image: %s", IMG_GetError());
+        return 1;
+    }
+
+    // Lista os PNGs em ordem de caminho para o resultado não depender do sistema de arquivos
+    std::vector<std::string> paths;
+    for (size_t i = 2; i < positional.size(); i++) {
+        fs::path dir = assetsDir / positional[i];
+        if (!fs::is_directory(dir)) {
+            SDL_Log("Pasta não encontrada: %s", dir.string().c_str());
+            continue;
+        }
+        for (const auto& entry : fs::recursive_directory_iterator(dir)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".png") {
+                paths.emplace_back(fs::relative(entry.path(), assetsDir).generic_string());
+            }
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<Image> images;
+    int numSkipped = 0;
+    for (const std::string& path : paths) {
+        SDL_Surface* loaded = IMG_Load((assetsDir / path).string().c_str());
+        if (!loaded) {
+            SDL_Log("Falha ao carregar %s: %s", path.c_str(), IMG_GetError());
+            continue;
+        }
+
+        if (loaded->w > maxImageSize || loaded->h > maxImageSize) {
+            SDL_FreeSurface(loaded);
+            numSkipped++;
+            continue;
+        }
+
+        SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+        if (!surface) {
+            SDL_Log("Falha ao converter %s: %s", path.c_str(), SDL_GetError());
+            continue;
+        }
+
+        images.emplace_back(Image{path, surface, -1, 0, 0});
+    }
+
+    // Mais altas primeiro deixam as prateleiras mais cheias
+    std::stable_sort(images.begin(), images.end(), [](const Image& a, const Image& b) {
+        return a.mSurface->h > b.mSurface->h;
+    });
+
+    std::vector<Page> pages;
+    for (Image& image : images) {
+        for (int i = 0; i < static_cast<int>(pages.size()) && image.mPage < 0; i++) {
+            if (PlaceImage(pages[i], image, pageSize)) {
+                image.mPage = i;
+            }
+        }
+        if (image.mPage < 0) {
+            pages.emplace_back(Page{{}, 0});
+            PlaceImage(pages.back(), image, pageSize);
+            image.mPage = static_cast<int>(pages.size()) - 1;
+        }
+    }
+
+    fs::create_directories(outputDir);
+
+    nlohmann::json manifest;
+    manifest["pages"] = nlohmann::json::array();
+    manifest["images"] = nlohmann::json::array();
+
+    bool succeeded = true;
+    for (int i = 0; i < static_cast<int>(pages.size()); i++) {
+        SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, pageSize, pageSize, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!pageSurface) {
+            SDL_Log("Falha ao criar página %d: %s", i, SDL_GetError());
+            succeeded = false;
+            break;
+        }
+        SDL_FillRect(pageSurface, nullptr, SDL_MapRGBA(pageSurface->format, 0, 0, 0, 0));
+
+        for (const Image& image : images) {
+            if (image.mPage != i) {
+                continue;
+            }
+            // Copia os pixels como estão, inclusive o alfa
+            SDL_SetSurfaceBlendMode(image.mSurface, SDL_BLENDMODE_NONE);
+            SDL_Rect dstRect = {image.mX, image.mY, image.mSurface->w, image.mSurface->h};
+            SDL_BlitSurface(image.mSurface, nullptr, pageSurface, &dstRect);
+        }
+
+        std::string pageName = "Atlas" + std::to_string(i) + ".png";
+        if (IMG_SavePNG(pageSurface, (outputDir / pageName).string().c_str()) != 0) {
+            SDL_Log("Falha ao salvar %s: %s", pageName.c_str(), IMG_GetError());
+            succeeded = false;
+        }
+        SDL_FreeSurface(pageSurface);
+        manifest["pages"].push_back(pageName);
+    }
+
+    for (const Image& image : images) {
+        manifest["images"].push_back({
+            {"path", image.mPath},
+            {"page", image.mPage},
+            {"x", image.mX},
+            {"y", image.mY},
+            {"w", image.mSurface->w},
+            {"h", image.mSurface->h}
+        });
+        SDL_FreeSurface(image.mSurface);
+    }
+
+    if (succeeded) {
+        std::ofstream manifestFile(outputDir / "Atlas.json");
+        manifestFile << manifest.dump(1) << "\n";
+        SDL_Log("%d imagens em %d páginas de %dx%d (%d grandes demais ficaram de fora)",
+                static_cast<int>(images.size()), static_cast<int>(pages.size()), pageSize, pageSize, numSkipped);
+    }
+
+    IMG_Quit();
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,70 @@
+// Offline level compiler.
+//
+// Usage: level-compiler <levelsDir>
+//
+// Compiles every Tiled map <name>.json found under <levelsDir> that has a <name>TileSet.json
+// next to it into <name>.level, the binary format read by LevelFile::Load. The game loads the
+// .level instead of parsing the json when it is not older than the map nor its tile set.
+
+#define SDL_MAIN_HANDLED
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <SDL.h>
+#include "LevelFile.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    void PrintUsage()
+    {
+        SDL_Log("Uso: level-compiler <levelsDir>");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    fs::path levelsDir = argv[1];
+    if (!fs::is_directory(levelsDir)) {
+        SDL_Log("Pasta não encontrada: %s", levelsDir.string().c_str());
+        return 1;
+    }
+
+    // Mapas são os json com um TileSet.json ao lado; o próprio TileSet.json não é mapa
+    std::vector<fs::path> maps;
+    for (const auto& entry : fs::recursive_directory_iterator(levelsDir)) {
+        const fs::path& path = entry.path();
+        if (!entry.is_regular_file() || path.extension() != ".json") {
+            continue;
+        }
+        fs::path tileSetPath = path.parent_path() / (path.stem().string() + "TileSet.json");
+        if (fs::exists(tileSetPath)) {
+            maps.emplace_back(path);
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+
+    int numFailed = 0;
+    for (const fs::path& mapPath : maps) {
+        fs::path basePath = mapPath.parent_path() / mapPath.stem();
+        fs::path tileSetPath = basePath.string() + "TileSet.json";
+        fs::path outputPath = basePath.string() + ".level";
+
+        LevelFile level;
+        if (!level.LoadJson(mapPath.string(), tileSetPath.string()) || !level.Save(outputPath.string())) {
+            numFailed++;
+            continue;
+        }
+        SDL_Log("%s: %d objetos, %d bytes", outputPath.string().c_str(), level.GetNumObjects(), level.GetSizeInBytes());
+    }
+
+    SDL_Log("%d fases compiladas (%d falharam)", static_cast<int>(maps.size()) - numFailed, numFailed);
+    return numFailed == 0 ? 0 : 1;
+}